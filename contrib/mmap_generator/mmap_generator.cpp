@@ -0,0 +1,447 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ * Offline generator of navigation data (*.mmtile) used by server path finding.
+ * Input is extracted terrain (maps/*.map from ad) and optionally assembled
+ * vmaps (vmaps/*.vmtree, *.vmtile from vmap_assembler) for WMO floors and walls.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <map>
+#include <set>
+#include <vector>
+
+#ifdef WIN32
+#include <windows.h>
+#include <direct.h>
+#define mkdir_p(a) _mkdir(a)
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#define mkdir_p(a) mkdir(a, 0755)
+#endif
+
+#include "MoveMapDefines.h"
+#include "VMapManager2.h"
+
+//=======================================================
+// .map file format, must be same as in src/game/GridMap.h
+
+struct map_fileheader
+{
+    uint32 mapMagic;
+    uint32 versionMagic;
+    uint32 buildMagic;
+    uint32 areaMapOffset;
+    uint32 areaMapSize;
+    uint32 heightMapOffset;
+    uint32 heightMapSize;
+    uint32 liquidMapOffset;
+    uint32 liquidMapSize;
+};
+
+#define MAP_HEIGHT_NO_HEIGHT  0x0001
+#define MAP_HEIGHT_AS_INT16   0x0002
+#define MAP_HEIGHT_AS_INT8    0x0004
+
+struct map_heightHeader
+{
+    uint32 fourcc;
+    uint32 flags;
+    float  gridHeight;
+    float  gridMaxHeight;
+};
+
+#define MAP_LIQUID_NO_TYPE    0x0001
+#define MAP_LIQUID_NO_HEIGHT  0x0002
+
+struct map_liquidHeader
+{
+    uint32 fourcc;
+    uint16 flags;
+    uint16 liquidType;
+    uint8  offsetX;
+    uint8  offsetY;
+    uint8  width;
+    uint8  height;
+    float  liquidLevel;
+};
+
+#define INVALID_HEIGHT          -100000.0f
+
+// walkable terrain parameters
+#define MAX_WALKABLE_SLOPE      1.2f                        // ~50 degrees, height diff per horizontal yard
+#define MIN_WATER_DEPTH         1.8f                        // deeper water only for swimmers
+#define AGENT_HEIGHT            2.0f                        // LOS ray height above ground between cells
+#define WMO_SEARCH_HEIGHT       50.0f                       // look for model floor from this height above terrain
+
+//=======================================================
+struct TileTerrain
+{
+    uint32 build;
+    float height[MMAP_CELLS_PER_GRID * MMAP_CELLS_PER_GRID];
+    float liquid[MMAP_CELLS_PER_GRID * MMAP_CELLS_PER_GRID];
+};
+
+typedef std::map<uint32, TileTerrain*> TerrainMap;          // key is gx*64+gy
+
+static char const* g_dataPath = "./";
+static VMAP::VMapManager2* g_vmapManager = NULL;
+
+bool loadTerrain(uint32 mapId, uint32 gx, uint32 gy, TileTerrain& terrain)
+{
+    char fileName[1024];
+    snprintf(fileName, sizeof(fileName), "%s/maps/%03u%02u%02u.map", g_dataPath, mapId, gx, gy);
+
+    FILE* in = fopen(fileName, "rb");
+    if (!in)
+        return false;
+
+    map_fileheader header;
+    if (fread(&header, sizeof(header), 1, in) != 1 || memcmp(&header.mapMagic, "MAPS", 4) != 0)
+    {
+        printf("Bad map file %s\n", fileName);
+        fclose(in);
+        return false;
+    }
+
+    terrain.build = header.buildMagic;
+
+    for (int i = 0; i < MMAP_CELLS_PER_GRID * MMAP_CELLS_PER_GRID; ++i)
+    {
+        terrain.height[i] = INVALID_HEIGHT;
+        terrain.liquid[i] = INVALID_HEIGHT;
+    }
+
+    // cell center height is the V8 point of .map height data
+    if (header.heightMapOffset)
+    {
+        map_heightHeader hh;
+        fseek(in, header.heightMapOffset, SEEK_SET);
+        fread(&hh, sizeof(hh), 1, in);
+
+        if (hh.flags & MAP_HEIGHT_NO_HEIGHT)
+        {
+            for (int i = 0; i < MMAP_CELLS_PER_GRID * MMAP_CELLS_PER_GRID; ++i)
+                terrain.height[i] = hh.gridHeight;
+        }
+        else if (hh.flags & MAP_HEIGHT_AS_INT16)
+        {
+            std::vector<uint16> v8(128*128);
+            fseek(in, 129*129*sizeof(uint16), SEEK_CUR);
+            fread(&v8[0], sizeof(uint16), 128*128, in);
+            float mult = (hh.gridMaxHeight - hh.gridHeight) / 65535;
+            for (int i = 0; i < 128*128; ++i)
+                terrain.height[i] = v8[i] * mult + hh.gridHeight;
+        }
+        else if (hh.flags & MAP_HEIGHT_AS_INT8)
+        {
+            std::vector<uint8> v8(128*128);
+            fseek(in, 129*129*sizeof(uint8), SEEK_CUR);
+            fread(&v8[0], sizeof(uint8), 128*128, in);
+            float mult = (hh.gridMaxHeight - hh.gridHeight) / 255;
+            for (int i = 0; i < 128*128; ++i)
+                terrain.height[i] = v8[i] * mult + hh.gridHeight;
+        }
+        else
+        {
+            fseek(in, 129*129*sizeof(float), SEEK_CUR);
+            fread(terrain.height, sizeof(float), 128*128, in);
+        }
+    }
+
+    if (header.liquidMapOffset)
+    {
+        map_liquidHeader lh;
+        fseek(in, header.liquidMapOffset, SEEK_SET);
+        fread(&lh, sizeof(lh), 1, in);
+
+        std::vector<uint8> types(16*16, uint8(lh.liquidType));
+        if (!(lh.flags & MAP_LIQUID_NO_TYPE))
+            fread(&types[0], sizeof(uint8), 16*16, in);
+
+        std::vector<float> levels;
+        if (!(lh.flags & MAP_LIQUID_NO_HEIGHT))
+        {
+            levels.resize(lh.width * lh.height);
+            fread(&levels[0], sizeof(float), lh.width * lh.height, in);
+        }
+
+        for (int x = 0; x < 128; ++x)
+        {
+            for (int y = 0; y < 128; ++y)
+            {
+                if (!types[(x >> 3) * 16 + (y >> 3)])
+                    continue;
+
+                int lx = x - lh.offsetY;
+                int ly = y - lh.offsetX;
+                if (lx < 0 || lx >= lh.height || ly < 0 || ly >= lh.width)
+                    continue;
+
+                terrain.liquid[x * 128 + y] = levels.empty() ? lh.liquidLevel : levels[lx * lh.width + ly];
+            }
+        }
+    }
+
+    fclose(in);
+    return true;
+}
+
+inline void cellCenter(uint32 cx, uint32 cy, float& x, float& y)
+{
+    x = (32 - (cx + 0.5f) / MMAP_CELLS_PER_GRID) * MMAP_GRID_SIZE;
+    y = (32 - (cy + 0.5f) / MMAP_CELLS_PER_GRID) * MMAP_GRID_SIZE;
+}
+
+// ground height of cell in whole map cell space, also return flags
+bool getCellGround(uint32 mapId, TerrainMap& terrainMap, int32 cx, int32 cy, float& height, uint8& flags)
+{
+    if (cx < 0 || cy < 0 || cx >= MMAP_MAX_CELLS || cy >= MMAP_MAX_CELLS)
+        return false;
+
+    TerrainMap::const_iterator itr = terrainMap.find((cx / MMAP_CELLS_PER_GRID) * MMAP_MAX_GRIDS + cy / MMAP_CELLS_PER_GRID);
+    if (itr == terrainMap.end())
+        return false;
+
+    int idx = (cx % MMAP_CELLS_PER_GRID) * MMAP_CELLS_PER_GRID + cy % MMAP_CELLS_PER_GRID;
+    height = itr->second->height[idx];
+    flags = 0;
+
+    if (height <= INVALID_HEIGHT)
+    {
+        flags |= MMAP_CELL_NO_GROUND;
+        return true;
+    }
+
+    // model floor (buildings, bridges) above terrain replaces terrain, only one level supported
+    if (g_vmapManager)
+    {
+        float x, y;
+        cellCenter(cx, cy, x, y);
+        float wmoHeight = g_vmapManager->getHeight(mapId, x, y, height + WMO_SEARCH_HEIGHT, WMO_SEARCH_HEIGHT + 1.0f);
+        if (wmoHeight > VMAP_INVALID_HEIGHT && wmoHeight > height + 0.5f)
+        {
+            height = wmoHeight;
+            flags |= MMAP_CELL_WMO;
+        }
+    }
+
+    float liquid = itr->second->liquid[idx];
+    if (liquid > INVALID_HEIGHT && liquid - height > MIN_WATER_DEPTH)
+        flags |= MMAP_CELL_WATER;
+
+    return true;
+}
+
+bool buildTile(uint32 mapId, uint32 gx, uint32 gy, TerrainMap& terrainMap)
+{
+    TileTerrain const* terrain = terrainMap[gx * MMAP_MAX_GRIDS + gy];
+
+    std::vector<MoveMapCell> cells(MMAP_CELLS_PER_GRID * MMAP_CELLS_PER_GRID);
+
+    for (int i = 0; i < MMAP_CELLS_PER_GRID; ++i)
+    {
+        for (int j = 0; j < MMAP_CELLS_PER_GRID; ++j)
+        {
+            int32 cx = gx * MMAP_CELLS_PER_GRID + i;
+            int32 cy = gy * MMAP_CELLS_PER_GRID + j;
+
+            MoveMapCell& cell = cells[i * MMAP_CELLS_PER_GRID + j];
+            cell.links = 0;
+            cell.reserved = 0;
+            getCellGround(mapId, terrainMap, cx, cy, cell.height, cell.flags);
+            if (cell.flags & MMAP_CELL_NO_GROUND)
+                continue;
+
+            float x, y;
+            cellCenter(cx, cy, x, y);
+
+            for (int dir = 0; dir < MMAP_DIR_COUNT; ++dir)
+            {
+                int32 nx = cx + MoveMapDirOffsetX[dir];
+                int32 ny = cy + MoveMapDirOffsetY[dir];
+
+                float nHeight;
+                uint8 nFlags;
+                if (!getCellGround(mapId, terrainMap, nx, ny, nHeight, nFlags) || (nFlags & MMAP_CELL_NO_GROUND))
+                    continue;
+
+                float dist = (dir & 1) ? MMAP_CELL_SIZE * 1.41421356f : MMAP_CELL_SIZE;
+
+                // swimming between water cells ignores slope
+                bool inWater = (cell.flags & MMAP_CELL_WATER) && (nFlags & MMAP_CELL_WATER);
+                if (!inWater && fabs(nHeight - cell.height) > dist * MAX_WALKABLE_SLOPE)
+                    continue;
+
+                if (g_vmapManager)
+                {
+                    float tx, ty;
+                    cellCenter(nx, ny, tx, ty);
+                    if (!g_vmapManager->isInLineOfSight(mapId, x, y, cell.height + AGENT_HEIGHT, tx, ty, nHeight + AGENT_HEIGHT))
+                        continue;
+                }
+
+                cell.links |= uint8(1 << dir);
+            }
+        }
+    }
+
+    char fileName[1024];
+    snprintf(fileName, sizeof(fileName), "%s/mmaps/%03u%02u%02u.mmtile", g_dataPath, mapId, gx, gy);
+
+    FILE* out = fopen(fileName, "wb");
+    if (!out)
+    {
+        printf("Can't create file %s\n", fileName);
+        return false;
+    }
+
+    MoveMapFileHeader header;
+    memcpy(&header.mmapMagic, MMAP_MAGIC, 4);
+    memcpy(&header.versionMagic, MMAP_VERSION_MAGIC, 4);
+    header.buildMagic = terrain->build;
+    header.cellsPerGrid = MMAP_CELLS_PER_GRID;
+
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(&cells[0], sizeof(MoveMapCell), cells.size(), out);
+    fclose(out);
+    return true;
+}
+
+//=======================================================
+typedef std::map<uint32, std::set<uint32> > MapTileList;    // map id -> gx*64+gy
+
+void collectTiles(MapTileList& tiles, int onlyMapId)
+{
+    std::vector<std::string> files;
+    std::string path = std::string(g_dataPath) + "/maps/";
+
+#ifdef WIN32
+    WIN32_FIND_DATA findData;
+    HANDLE hFind = FindFirstFile((path + "*.map").c_str(), &findData);
+    if (hFind != INVALID_HANDLE_VALUE)
+    {
+        do
+            files.push_back(findData.cFileName);
+        while (FindNextFile(hFind, &findData));
+        FindClose(hFind);
+    }
+#else
+    if (DIR* dir = opendir(path.c_str()))
+    {
+        while (dirent* entry = readdir(dir))
+            files.push_back(entry->d_name);
+        closedir(dir);
+    }
+#endif
+
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        std::string const& name = files[i];
+        if (name.size() != 11 || name.substr(7) != ".map")
+            continue;
+
+        uint32 mapId = atoi(name.substr(0, 3).c_str());
+        uint32 gx = atoi(name.substr(3, 2).c_str());
+        uint32 gy = atoi(name.substr(5, 2).c_str());
+
+        if (onlyMapId >= 0 && uint32(onlyMapId) != mapId)
+            continue;
+
+        if (gx < MMAP_MAX_GRIDS && gy < MMAP_MAX_GRIDS)
+            tiles[mapId].insert(gx * MMAP_MAX_GRIDS + gy);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || argc > 4)
+    {
+        printf("\nusage: %s <data dir> [map id] [novmaps]\n", argv[0]);
+        printf("  reads <data dir>/maps and <data dir>/vmaps, writes <data dir>/mmaps\n");
+        return 1;
+    }
+
+    g_dataPath = argv[1];
+    int onlyMapId = argc >= 3 ? atoi(argv[2]) : -1;
+    bool useVmaps = !(argc >= 4 && strcmp(argv[3], "novmaps") == 0);
+
+    mkdir_p((std::string(g_dataPath) + "/mmaps").c_str());
+
+    MapTileList tiles;
+    collectTiles(tiles, onlyMapId);
+    if (tiles.empty())
+    {
+        printf("No map files found in %s/maps\n", g_dataPath);
+        return 1;
+    }
+
+    std::string vmapPath = std::string(g_dataPath) + "/vmaps";
+    if (useVmaps)
+        g_vmapManager = new VMAP::VMapManager2();
+
+    for (MapTileList::const_iterator mapItr = tiles.begin(); mapItr != tiles.end(); ++mapItr)
+    {
+        uint32 mapId = mapItr->first;
+        printf("Building map %03u (%u tiles)\n", mapId, uint32(mapItr->second.size()));
+
+        // whole map terrain kept loaded, links at tile borders need neighbour tiles
+        TerrainMap terrainMap;
+        for (std::set<uint32>::const_iterator itr = mapItr->second.begin(); itr != mapItr->second.end(); ++itr)
+        {
+            uint32 gx = *itr / MMAP_MAX_GRIDS;
+            uint32 gy = *itr % MMAP_MAX_GRIDS;
+
+            TileTerrain* terrain = new TileTerrain;
+            if (!loadTerrain(mapId, gx, gy, *terrain))
+            {
+                delete terrain;
+                continue;
+            }
+
+            terrainMap[*itr] = terrain;
+
+            if (g_vmapManager)
+                g_vmapManager->loadMap(vmapPath.c_str(), mapId, gx, gy);
+        }
+
+        for (TerrainMap::const_iterator itr = terrainMap.begin(); itr != terrainMap.end(); ++itr)
+        {
+            uint32 gx = itr->first / MMAP_MAX_GRIDS;
+            uint32 gy = itr->first % MMAP_MAX_GRIDS;
+            printf("  tile %02u,%02u\n", gx, gy);
+            buildTile(mapId, gx, gy, terrainMap);
+        }
+
+        for (TerrainMap::iterator itr = terrainMap.begin(); itr != terrainMap.end(); ++itr)
+            delete itr->second;
+
+        if (g_vmapManager)
+            g_vmapManager->unloadMap(mapId);
+    }
+
+    delete g_vmapManager;
+    printf("Ok, all done\n");
+    return 0;
+}
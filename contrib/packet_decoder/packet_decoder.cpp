@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <string>
+#include <set>
+#include <map>
+#include <vector>
+
+#ifdef WIN32
+#define strcasecmp _stricmp
+#pragma warning (disable:4996)
+#endif
+
+// must be same as in src/game/PacketCapture.h
+#define PACKET_CAPTURE_MAGIC    0x544B504D                  // "MPKT"
+#define PACKET_CAPTURE_VERSION  1
+
+enum PacketCaptureRecordType
+{
+    PACKET_CAPTURE_RECORD_OPCODE_NAME = 1,
+    PACKET_CAPTURE_RECORD_PACKET      = 2,
+};
+
+typedef unsigned char uint8;
+typedef unsigned short uint16;
+typedef unsigned int uint32;
+typedef unsigned long long uint64;
+
+FILE* input = NULL;
+
+// capture file values little-endian, read them byte by byte for any host
+bool readBytes(void* dest, size_t size)
+{
+    return fread(dest, 1, size, input) == size;
+}
+
+bool readUInt(uint64& value, size_t size)
+{
+    uint8 buf[8];
+    if (!readBytes(buf, size))
+        return false;
+
+    value = 0;
+    for (size_t i = size; i > 0; --i)
+        value = (value << 8) | buf[i - 1];
+    return true;
+}
+
+bool readUInt8(uint32& value)  { uint64 v; if (!readUInt(v, 1)) return false; value = uint32(v); return true; }
+bool readUInt16(uint32& value) { uint64 v; if (!readUInt(v, 2)) return false; value = uint32(v); return true; }
+bool readUInt32(uint32& value) { uint64 v; if (!readUInt(v, 4)) return false; value = uint32(v); return true; }
+
+void printUsage(char const* prg)
+{
+    printf("Usage: %s [-o opcode] [-a account] [-n] capturefile\n"
+        "    -o opcode    print only packets with opcode (number, 0x hex number or name), can be repeated\n"
+        "    -a account   print only packets of account id, can be repeated\n"
+        "    -n           print packet headers only, without data\n", prg);
+}
+
+void printData(std::vector<uint8> const& data)
+{
+    printf("OFFSET  00 01 02 03 04 05 06 07 08 09 0A 0B 0C 0D 0E 0F | 0123456789ABCDEF\n");
+    printf("--------------------------------------------------------------------------\n");
+
+    for (size_t line = 0; line < data.size(); line += 16)
+    {
+        printf("%06X  ", uint32(line));
+
+        for (size_t i = line; i < line + 16; ++i)
+        {
+            if (i < data.size())
+                printf("%.2X ", data[i]);
+            else
+                printf("   ");
+        }
+
+        printf("| ");
+        for (size_t i = line; i < line + 16 && i < data.size(); ++i)
+            printf("%c", isprint(data[i]) ? data[i] : '.');
+        printf("\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::set<uint32> opcodeFilter;
+    std::set<std::string> opcodeNameFilter;
+    std::set<uint32> accountFilter;
+    bool printPacketData = true;
+    char const* filename = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+        {
+            char const* arg = argv[++i];
+            if (isdigit(*arg))
+                opcodeFilter.insert(uint32(strtoul(arg, NULL, 0)));
+            else
+                opcodeNameFilter.insert(arg);
+        }
+        else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc)
+            accountFilter.insert(uint32(strtoul(argv[++i], NULL, 10)));
+        else if (strcmp(argv[i], "-n") == 0)
+            printPacketData = false;
+        else if (!filename && argv[i][0] != '-')
+            filename = argv[i];
+        else
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (!filename)
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    input = fopen(filename, "rb");
+    if (!input)
+    {
+        printf("Can't open %s\n", filename);
+        return 1;
+    }
+
+    uint32 magic, version, reserved;
+    uint64 startTime;
+    if (!readUInt32(magic) || !readUInt16(version) || !readUInt16(reserved) || !readUInt(startTime, 8) ||
+        magic != PACKET_CAPTURE_MAGIC)
+    {
+        printf("%s is not packet capture file\n", filename);
+        fclose(input);
+        return 1;
+    }
+
+    if (version != PACKET_CAPTURE_VERSION)
+    {
+        printf("Unsupported capture file version %u, expected %u\n", version, PACKET_CAPTURE_VERSION);
+        fclose(input);
+        return 1;
+    }
+
+    time_t start = time_t(startTime);
+    char timeStr[32];
+    strftime(timeStr, 32, "%Y-%m-%d %H:%M:%S", localtime(&start));
+    printf("Capture started at %s\n\n", timeStr);
+
+    std::map<uint32, std::string> opcodeNames;
+    std::vector<uint8> data;
+    uint32 packets = 0;
+    uint32 printed = 0;
+
+    uint32 type;
+    while (readUInt8(type))
+    {
+        if (type == PACKET_CAPTURE_RECORD_OPCODE_NAME)
+        {
+            uint32 opcode, length;
+            if (!readUInt16(opcode) || !readUInt8(length))
+                break;
+
+            std::string name(length, ' ');
+            if (length && !readBytes(&name[0], length))
+                break;
+
+            opcodeNames[opcode] = name;
+        }
+        else if (type == PACKET_CAPTURE_RECORD_PACKET)
+        {
+            uint32 msTime, socket, account, direction, opcode, size;
+            if (!readUInt32(msTime) || !readUInt32(socket) || !readUInt32(account) || !readUInt8(direction) ||
+                !readUInt16(opcode) || !readUInt32(size))
+                break;
+
+            data.resize(size);
+            if (size && !readBytes(&data[0], size))
+                break;
+
+            ++packets;
+
+            std::map<uint32, std::string>::const_iterator nameItr = opcodeNames.find(opcode);
+            char const* name = nameItr != opcodeNames.end() ? nameItr->second.c_str() : "UNKNOWN";
+
+            if (!opcodeFilter.empty() || !opcodeNameFilter.empty())
+            {
+                bool match = opcodeFilter.find(opcode) != opcodeFilter.end();
+                for (std::set<std::string>::const_iterator itr = opcodeNameFilter.begin(); !match && itr != opcodeNameFilter.end(); ++itr)
+                    match = strcasecmp(itr->c_str(), name) == 0;
+
+                if (!match)
+                    continue;
+            }
+
+            if (!accountFilter.empty() && accountFilter.find(account) == accountFilter.end())
+                continue;
+
+            ++printed;
+
+            time_t packetTime = start + msTime / 1000;
+            strftime(timeStr, 32, "%Y-%m-%d %H:%M:%S", localtime(&packetTime));
+
+            printf("%s.%03u %s:\nSOCKET: %u ACCOUNT: %u\nLENGTH: %u\nOPCODE: %s (0x%.4X)\n",
+                timeStr, msTime % 1000, direction ? "SERVER" : "CLIENT", socket, account, size, name, opcode);
+
+            if (printPacketData && size)
+            {
+                printf("DATA:\n");
+                printData(data);
+            }
+
+            printf("\n");
+        }
+        else
+        {
+            printf("Unknown record type %u, capture file corrupted\n", type);
+            break;
+        }
+    }
+
+    if (!feof(input))
+        printf("Capture file read stopped at offset %ld\n", ftell(input));
+
+    printf("%u packets in capture, %u printed\n", packets, printed);
+
+    fclose(input);
+    return 0;
+}
@@ -0,0 +1,4 @@
+ALTER TABLE character_db_version CHANGE COLUMN required_10332_02_characters_pet_aura required_10352_01_characters_saved_variables bit;
+
+-- convert item_instance.data and characters update field arrays to compact form at next server start (CleanCharacterDB = 1)
+UPDATE saved_variables SET cleaning_flags = cleaning_flags | 0x10;
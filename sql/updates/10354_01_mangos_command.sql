@@ -0,0 +1,9 @@
+ALTER TABLE db_version CHANGE COLUMN required_10353_01_mangos_command required_10354_01_mangos_command bit;
+
+DELETE FROM command WHERE name IN ('debug capture','debug capture account','debug capture opcode','debug capture start','debug capture stop');
+INSERT INTO command (name, security, help) VALUES
+('debug capture',3,'Syntax: .debug capture\r\n\r\nShow packet capture state, captured, dropped and written amounts and active opcode and account filters.'),
+('debug capture account',3,'Syntax: .debug capture account [#accountId|$accountName]\r\n\r\nAdd account to packet capture filter or remove it if already added. Without argument clear filter. With empty filter packets of all accounts captured.'),
+('debug capture opcode',3,'Syntax: .debug capture opcode [#opcode|$opcodename]\r\n\r\nAdd opcode (decimal or 0x hex number, or name) to packet capture filter or remove it if already added. Without argument clear filter. With empty filter all opcodes captured.'),
+('debug capture start',3,'Syntax: .debug capture start [$filename]\r\n\r\nStart binary packet capture to $filename in logs directory, by default packets_YYYY-MM-DD_HH-MM-SS.cap. Capture files can be printed by contrib/packet_decoder tool.'),
+('debug capture stop',3,'Syntax: .debug capture stop\r\n\r\nStop packet capture and close capture file.');
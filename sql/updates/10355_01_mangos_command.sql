@@ -0,0 +1,5 @@
+ALTER TABLE db_version CHANGE COLUMN required_10354_01_mangos_command required_10355_01_mangos_command bit;
+
+DELETE FROM command WHERE name IN ('server persistence stats');
+INSERT INTO command (name, security, help) VALUES
+('server persistence stats',3,'Syntax: .server persistence stats\r\n\r\nShow batched item row changes, coalesced changes, written rows and statements amount and player autosave backlog.');
@@ -18,9 +18,17 @@
 
 #include "EventProcessor.h"
 
+#include <algorithm>
+
+static bool IsLaterEvent(EventEntry const& entry, uint64 e_time)
+{
+    return entry.time > e_time;
+}
+
 EventProcessor::EventProcessor()
 {
     m_time = 0;
+    m_nextTime = ~uint64(0);
     m_aborting = false;
 }
 
@@ -34,13 +42,15 @@ void EventProcessor::Update(uint32 p_time)
     // update time
     m_time += p_time;
 
+    if (m_nextTime > m_time)
+        return;
+
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    while (!m_events.empty() && m_events.back().time <= m_time)
     {
         // get and remove event from queue
-        BasicEvent* Event = i->second;
-        m_events.erase(i);
+        BasicEvent* Event = m_events.back().event;
+        m_events.pop_back();
 
         if (!Event->to_Abort)
         {
@@ -56,33 +66,35 @@ void EventProcessor::Update(uint32 p_time)
             delete Event;
         }
     }
+
+    m_nextTime = m_events.empty() ? ~uint64(0) : m_events.back().time;
 }
 
 void EventProcessor::KillAllEvents(bool force)
 {
-    // prevent event insertions
+    // insertions still accepted, events added by Abort calls processed below
     m_aborting = true;
 
-    // first, abort all existing events
-    for (EventList::iterator i = m_events.begin(); i != m_events.end();)
+    EventList events;
+    do
     {
-        EventList::iterator i_old = i;
-        ++i;
+        // events added by abort calls go to emptied m_events
+        events.clear();
+        events.swap(m_events);
+        m_nextTime = ~uint64(0);
 
-        i_old->second->to_Abort = true;
-        i_old->second->Abort(m_time);
-        if (force || i_old->second->IsDeletable())
+        for (EventList::reverse_iterator i = events.rbegin(); i != events.rend(); ++i)
         {
-            delete i_old->second;
-
-            if (!force)                                      // need per-element cleanup
-                m_events.erase (i_old);
+            i->event->to_Abort = true;
+            i->event->Abort(m_time);
+            if (force || i->event->IsDeletable())
+                delete i->event;
+            else                                            // need per-element cleanup later
+                AddEvent(i->event, i->time, false);
         }
     }
-
-    // fast clear event list (in force case)
-    if (force)
-        m_events.clear();
+    // in force case nothing can stay in queue, repeat for events added by abort calls
+    while (force && !m_events.empty());
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime)
@@ -91,7 +103,15 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
 
     Event->m_execTime = e_time;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+
+    // before events with same time, they will be executed first
+    EventEntry entry;
+    entry.time = e_time;
+    entry.event = Event;
+    m_events.insert(std::lower_bound(m_events.begin(), m_events.end(), e_time, IsLaterEvent), entry);
+
+    if (e_time < m_nextTime)
+        m_nextTime = e_time;
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset)
@@ -21,7 +21,7 @@
 
 #include "Platform/Define.h"
 
-#include <map>
+#include <vector>
 
 // Note. All times are in milliseconds here.
 
@@ -55,7 +55,15 @@ class BasicEvent
         uint64 m_execTime;                                  // planned time of next execution, filled by event handler
 };
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+struct EventEntry
+{
+    uint64 time;                                            // copy of exec time, queue search not touch events
+    BasicEvent* event;
+};
+
+// Sorted by time descending, so next event is at back and executed events popped without moving others.
+// Objects have only few events in queue, flat array with kept capacity cheaper than tree node per event.
+typedef std::vector<EventEntry> EventList;
 
 class EventProcessor
 {
@@ -73,6 +81,7 @@ class EventProcessor
 
         uint64 m_time;
         EventList m_events;
+        uint64 m_nextTime;                                  // time of first event, idle updates not touch queue
         bool m_aborting;
 };
 
@@ -374,6 +374,7 @@ bool AchievementCriteriaRequirementSet::Meets(Player const* source, Unit const*
 AchievementMgr::AchievementMgr(Player *player)
 {
     m_player = player;
+    m_completedCriteriaCache.resize(sAchievementCriteriaStore.GetNumRows(), false);
 }
 
 AchievementMgr::~AchievementMgr()
@@ -398,6 +399,9 @@ void AchievementMgr::Reset()
 
     m_completedAchievements.clear();
     m_criteriaProgress.clear();
+    m_completedCriteriaCache.assign(m_completedCriteriaCache.size(), false);
+    m_changedAchievements.clear();
+    m_changedCriteria.clear();
     DeleteFromDB(m_player->GetGUIDLow());
 
     // re-fill data
@@ -453,14 +457,17 @@ void AchievementMgr::DeleteFromDB(uint32 lowguid)
 
 void AchievementMgr::SaveToDB()
 {
-    if(!m_completedAchievements.empty())
+    if(!m_changedAchievements.empty())
     {
         bool need_execute = false;
         std::ostringstream ssdel;
         std::ostringstream ssins;
-        for(CompletedAchievementMap::iterator iter = m_completedAchievements.begin(); iter!=m_completedAchievements.end(); ++iter)
+        for(std::vector<uint32>::const_iterator changedItr = m_changedAchievements.begin(); changedItr != m_changedAchievements.end(); ++changedItr)
         {
-            if(!iter->second.changed)
+            CompletedAchievementMap::iterator iter = m_completedAchievements.find(*changedItr);
+
+            // removed before save
+            if(iter == m_completedAchievements.end() || !iter->second.changed)
                 continue;
 
             /// first new/changed record prefix
@@ -493,18 +500,21 @@ void AchievementMgr::SaveToDB()
             CharacterDatabase.Execute( ssdel.str().c_str() );
             CharacterDatabase.Execute( ssins.str().c_str() );
         }
+
+        m_changedAchievements.clear();
     }
 
-    if(!m_criteriaProgress.empty())
+    if(!m_changedCriteria.empty())
     {
         /// prepare deleting and insert
         bool need_execute_del = false;
         bool need_execute_ins = false;
         std::ostringstream ssdel;
         std::ostringstream ssins;
-        for(CriteriaProgressMap::iterator iter = m_criteriaProgress.begin(); iter!=m_criteriaProgress.end(); ++iter)
+        for(std::vector<uint32>::const_iterator changedItr = m_changedCriteria.begin(); changedItr != m_changedCriteria.end(); ++changedItr)
         {
-            if(!iter->second.changed)
+            CriteriaProgressMap::iterator iter = m_criteriaProgress.find(*changedItr);
+            if(iter == m_criteriaProgress.end() || !iter->second.changed)
                 continue;
 
             // deleted data (including 0 progress state)
@@ -554,6 +564,8 @@ void AchievementMgr::SaveToDB()
             if(need_execute_ins)
                 CharacterDatabase.Execute( ssins.str().c_str() );
         }
+
+        m_changedCriteria.clear();
     }
 }
 
@@ -612,12 +624,25 @@ void AchievementMgr::LoadFromDB(QueryResult *achievementResult, QueryResult *cri
                 {
                     progress.counter = maxcounter;
                     progress.changed = true;
+                    m_changedCriteria.push_back(id);
                 }
             }
         } while(criteriaResult->NextRow());
         delete criteriaResult;
     }
 
+    // completed criteria will not checked at login and following updates
+    for(CriteriaProgressMap::const_iterator iter = m_criteriaProgress.begin(); iter != m_criteriaProgress.end(); ++iter)
+    {
+        AchievementCriteriaEntry const* criteria = sAchievementCriteriaStore.LookupEntry(iter->first);
+        AchievementEntry const* achievement = sAchievementStore.LookupEntry(criteria->referredAchievement);
+        if (!achievement || achievement->flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
+            continue;
+
+        if (IsCompletedCriteria(criteria, achievement))
+            SetCompletedCriteriaCached(criteria->ID, true);
+    }
+
 }
 
 void AchievementMgr::SendAchievementEarned(AchievementEntry const* achievement)
@@ -679,13 +704,101 @@ void AchievementMgr::SendCriteriaUpdate(uint32 id, CriteriaProgress const* progr
 }
 
 /**
- * called at player login. The player might have fulfilled some achievements when the achievement system wasn't working yet
+ * called at player login. The player might have fulfilled some achievements when the achievement system wasn't working yet.
+ * Only criteria types that can get progress from player state are checked, other types updated only by events.
  */
 void AchievementMgr::CheckAllAchievementCriteria()
 {
     // suppress sending packets
-    for(uint32 i=0; i<ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++i)
-        UpdateAchievementCriteria(AchievementCriteriaTypes(i));
+    AchievementCriteriaTypeList const& types = sAchievementMgr.GetAchievementCriteriaTypesUpdatedAtLogin();
+    for(AchievementCriteriaTypeList::const_iterator itr = types.begin(); itr != types.end(); ++itr)
+        UpdateAchievementCriteria(*itr);
+}
+
+/**
+ * criteria types that UpdateAchievementCriteria update without event data (miscvalue1 == 0) from current player state
+ */
+static bool IsCriteriaTypeUpdatedAtLogin(AchievementCriteriaTypes type)
+{
+    switch (type)
+    {
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_ACHIEVEMENT:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST_COUNT:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_EXPLORE_AREA:
+        case ACHIEVEMENT_CRITERIA_TYPE_BUY_BANK_SLOT:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_EXALTED_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REVERED_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_HONORED_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_KNOWN_FACTIONS:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
+        case ACHIEVEMENT_CRITERIA_TYPE_EARN_HONORABLE_KILL:
+        case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_GOLD_VALUE_OWNED:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * for criteria types updated only by events with data equal to criteria data return this data as key,
+ * for map based types key is map where event happens
+ */
+static bool GetCriteriaIndexKey(AchievementCriteriaEntry const* criteria, uint32& key)
+{
+    switch (criteria->requiredType)
+    {
+        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:           key = criteria->kill_creature.creatureID;           return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_WIN_BG:                  key = criteria->win_bg.bgMapID;                     return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:       key = criteria->reach_skill_level.skillID;          return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE: key = criteria->complete_quests_in_zone.zoneID;     return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_BATTLEGROUND:   key = criteria->complete_battleground.mapID;        return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_DEATH_AT_MAP:            key = criteria->death_at_map.mapID;                 return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_KILLED_BY_CREATURE:      key = criteria->killed_by_creature.creatureEntry;   return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:          key = criteria->complete_quest.questID;             return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET2:        key = criteria->be_spell_target.spellID;            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:             key = criteria->cast_spell.spellID;                 return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:             key = criteria->learn_spell.spellID;                return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_TYPE:               key = criteria->loot_type.lootType;                 return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:                key = criteria->own_item.itemID;                    return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:       key = criteria->learn_skill_level.skillID;          return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_ITEM:                key = criteria->use_item.itemID;                    return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:               key = criteria->own_item.itemID;                    return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:         key = criteria->gain_reputation.factionID;          return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_CLASS:                key = criteria->hk_class.classID;                   return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_RACE:                 key = criteria->hk_race.raceID;                     return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_DO_EMOTE:                key = criteria->do_emote.emoteID;                   return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_ITEM:              key = criteria->equip_item.itemID;                  return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_GAMEOBJECT:          key = criteria->use_gameobject.goEntry;             return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_FISH_IN_GAMEOBJECT:      key = criteria->fish_in_gameobject.goEntry;         return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:  key = criteria->learn_skillline_spell.skillLine;    return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:        key = criteria->learn_skill_line.skillLine;         return true;
+        default:
+            return false;
+    }
+}
+
+static bool IsCriteriaTypeKeyedByMap(AchievementCriteriaTypes type)
+{
+    switch (type)
+    {
+        case ACHIEVEMENT_CRITERIA_TYPE_WIN_BG:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_BATTLEGROUND:
+        case ACHIEVEMENT_CRITERIA_TYPE_DEATH_AT_MAP:
+            return true;
+        default:
+            return false;
+    }
 }
 
 static const uint32 achievIdByArenaSlot[MAX_ARENA_SLOT] = { 1057, 1107, 1108 };
@@ -713,11 +826,20 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
     if (!sWorld.getConfig(CONFIG_BOOL_GM_ALLOW_ACHIEVEMENT_GAINS) && m_player->GetSession()->GetSecurity() > SEC_PLAYER)
         return;
 
-    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr.GetAchievementCriteriaByType(type);
-    for(AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList.begin(); i!=achievementCriteriaList.end(); ++i)
+    // update event data select only criteria with same data, login case (without data) check all criteria of type
+    AchievementCriteriaEntryList const* achievementCriteriaList = NULL;
+    if (miscvalue1)
+        achievementCriteriaList = sAchievementMgr.GetAchievementCriteriaByTypeAndKey(type, IsCriteriaTypeKeyedByMap(type) ? GetPlayer()->GetMapId() : miscvalue1);
+    if (!achievementCriteriaList)
+        achievementCriteriaList = &sAchievementMgr.GetAchievementCriteriaByType(type);
+
+    for(AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList->begin(); i!=achievementCriteriaList->end(); ++i)
     {
         AchievementCriteriaEntry const *achievementCriteria = (*i);
 
+        if (IsCompletedCriteriaCached(achievementCriteria->ID))
+            continue;
+
         if (achievementCriteria->groupFlag & ACHIEVEMENT_CRITERIA_GROUP_NOT_IN_GROUP && GetPlayer()->GetGroup())
             continue;
 
@@ -731,7 +853,12 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
 
         // don't update already completed criteria
         if (IsCompletedCriteria(achievementCriteria,achievement))
+        {
+            // realm first criteria can become not completed if someone else get achievement first
+            if (!(achievement->flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL)))
+                SetCompletedCriteriaCached(achievementCriteria->ID, true);
             continue;
+        }
 
         // init values, real set in switch
         uint32 change = 0;
@@ -1720,6 +1847,12 @@ bool AchievementMgr::IsCompletedCriteria(AchievementCriteriaEntry const* achieve
     return progress->counter >= maxcounter;
 }
 
+void AchievementMgr::SetCompletedCriteriaCached(uint32 criteriaId, bool completed)
+{
+    if (criteriaId < m_completedCriteriaCache.size())
+        m_completedCriteriaCache[criteriaId] = completed;
+}
+
 void AchievementMgr::CompletedCriteriaFor(AchievementEntry const* achievement)
 {
     // counter can never complete
@@ -1855,7 +1988,11 @@ void AchievementMgr::SetCriteriaProgress(AchievementCriteriaEntry const* criteri
         progress->counter = newValue;
     }
 
-    progress->changed = true;
+    if (!progress->changed)
+    {
+        progress->changed = true;
+        m_changedCriteria.push_back(criteria->ID);
+    }
 
     if(criteria->timeLimit)
     {
@@ -1898,6 +2035,8 @@ void AchievementMgr::SetCriteriaProgress(AchievementCriteriaEntry const* criteri
     // update dependent achievements state at criteria incomplete
     else if (old_value > progress->counter)
     {
+        SetCompletedCriteriaCached(criteria->ID, false);
+
         if (progress->counter < max_value)
         {
             WorldPacket data(SMSG_CRITERIA_DELETED,4);
@@ -1927,6 +2066,7 @@ void AchievementMgr::CompletedAchievement(AchievementEntry const* achievement)
     CompletedAchievementData& ca =  m_completedAchievements[achievement->ID];
     ca.date = time(NULL);
     ca.changed = true;
+    m_changedAchievements.push_back(achievement->ID);
 
     // don't insert for ACHIEVEMENT_FLAG_REALM_FIRST_KILL since otherwise only the first group member would reach that achievement
     // TODO: where do set this instead?
@@ -2071,6 +2211,20 @@ AchievementCriteriaEntryList const& AchievementGlobalMgr::GetAchievementCriteria
     return m_AchievementCriteriasByType[type];
 }
 
+AchievementCriteriaEntryList const* AchievementGlobalMgr::GetAchievementCriteriaByTypeAndKey(AchievementCriteriaTypes type, uint32 key) const
+{
+    static AchievementCriteriaEntryList const emptyList;
+
+    AchievementCriteriaListByKey const& byKey = m_AchievementCriteriasByTypeAndKey[type];
+
+    // not indexed type
+    if (byKey.empty())
+        return NULL;
+
+    AchievementCriteriaListByKey::const_iterator itr = byKey.find(key);
+    return itr != byKey.end() ? &itr->second : &emptyList;
+}
+
 void AchievementGlobalMgr::LoadAchievementCriteriaList()
 {
     if(sAchievementCriteriaStore.GetNumRows()==0)
@@ -2096,8 +2250,16 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
 
         m_AchievementCriteriasByType[criteria->requiredType].push_back(criteria);
         m_AchievementCriteriaListByAchievement[criteria->referredAchievement].push_back(criteria);
+
+        uint32 key;
+        if (GetCriteriaIndexKey(criteria, key))
+            m_AchievementCriteriasByTypeAndKey[criteria->requiredType][key].push_back(criteria);
     }
 
+    for (uint32 type = 0; type < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++type)
+        if (!m_AchievementCriteriasByType[type].empty() && IsCriteriaTypeUpdatedAtLogin(AchievementCriteriaTypes(type)))
+            m_AchievementCriteriaTypesUpdatedAtLogin.push_back(AchievementCriteriaTypes(type));
+
     sLog.outString();
     sLog.outString(">> Loaded %lu achievement criteria.",(unsigned long)m_AchievementCriteriasByType->size());
 }
@@ -32,6 +32,8 @@ typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
 typedef std::list<AchievementEntry const*>         AchievementEntryList;
 
 typedef std::map<uint32,AchievementCriteriaEntryList> AchievementCriteriaListByAchievement;
+typedef UNORDERED_MAP<uint32,AchievementCriteriaEntryList> AchievementCriteriaListByKey;
+typedef std::vector<AchievementCriteriaTypes> AchievementCriteriaTypeList;
 typedef std::map<uint32,AchievementEntryList>         AchievementListByReferencedId;
 
 struct CriteriaProgress
@@ -287,15 +289,26 @@ class AchievementMgr
         void CompleteAchievementsWithRefs(AchievementEntry const* entry);
         void BuildAllDataPacket(WorldPacket *data);
 
+        bool IsCompletedCriteriaCached(uint32 criteriaId) const
+        {
+            return criteriaId < m_completedCriteriaCache.size() && m_completedCriteriaCache[criteriaId];
+        }
+        void SetCompletedCriteriaCached(uint32 criteriaId, bool completed);
+
         Player* m_player;
         CriteriaProgressMap m_criteriaProgress;
         CompletedAchievementMap m_completedAchievements;
+        std::vector<bool> m_completedCriteriaCache;         // criteria found completed at update, can't become incomplete by new events
+        std::vector<uint32> m_changedAchievements;          // achievements with changed flag, saved at next SaveToDB
+        std::vector<uint32> m_changedCriteria;              // criteria progress with changed flag, saved at next SaveToDB
 };
 
 class AchievementGlobalMgr
 {
     public:
         AchievementCriteriaEntryList const& GetAchievementCriteriaByType(AchievementCriteriaTypes type);
+        AchievementCriteriaEntryList const* GetAchievementCriteriaByTypeAndKey(AchievementCriteriaTypes type, uint32 key) const;
+        AchievementCriteriaTypeList const& GetAchievementCriteriaTypesUpdatedAtLogin() const { return m_AchievementCriteriaTypesUpdatedAtLogin; }
         AchievementCriteriaEntryList const* GetAchievementCriteriaByAchievement(uint32 id)
         {
             AchievementCriteriaListByAchievement::const_iterator itr = m_AchievementCriteriaListByAchievement.find(id);
@@ -357,6 +370,10 @@ class AchievementGlobalMgr
 
         // store achievement criterias by type to speed up lookup
         AchievementCriteriaEntryList m_AchievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        // store achievement criterias by type and data required to be equal to update event data (creature/item/spell/map id, etc)
+        AchievementCriteriaListByKey m_AchievementCriteriasByTypeAndKey[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        // criteria types with existed criteria that can get progress from player state without update event
+        AchievementCriteriaTypeList m_AchievementCriteriaTypesUpdatedAtLogin;
         // store achievement criterias by achievement to speed up lookup
         AchievementCriteriaListByAchievement m_AchievementCriteriaListByAchievement;
         // store achievements by referenced achievement id to speed up lookup
@@ -538,39 +538,88 @@ AuctionHouseEntry const* AuctionHouseMgr::GetAuctionHouseEntry(Unit* unit)
     return sAuctionHouseStore.LookupEntry(houseid);
 }
 
+// expired auctions deleted from DB by one statement per this amount
+#define AUCTION_DELETE_BATCH_SIZE 100
+
 void AuctionHouseObject::Update()
 {
     time_t curTime = sWorld.GetGameTime();
-    ///- Handle expired auctions
-    AuctionEntryMap::iterator next;
-    for (AuctionEntryMap::iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end();itr = next)
+
+    std::vector<uint32> expiredIds;
+
+    ///- Handle expired auctions, index sorted by expire time so only expired visited
+    while (!AuctionsByExpireTime.empty() && curTime > AuctionsByExpireTime.begin()->first)
     {
-        next = itr;
-        ++next;
-        if (curTime > (itr->second->expire_time))
+        AuctionEntry* auction = GetAuction(AuctionsByExpireTime.begin()->second);
+        if (!auction)
         {
-            ///- Either cancel the auction if there was no bidder
-            if (itr->second->bidder == 0)
-            {
-                sAuctionMgr.SendAuctionExpiredMail( itr->second );
-            }
-            ///- Or perform the transaction
-            else
-            {
-                //we should send an "item sold" message if the seller is online
-                //we send the item to the winner
-                //we send the money to the seller
-                sAuctionMgr.SendAuctionSuccessfulMail( itr->second );
-                sAuctionMgr.SendAuctionWonMail( itr->second );
-            }
+            AuctionsByExpireTime.erase(AuctionsByExpireTime.begin());
+            continue;
+        }
+
+        ///- Either cancel the auction if there was no bidder
+        if (auction->bidder == 0)
+        {
+            sAuctionMgr.SendAuctionExpiredMail( auction );
+        }
+        ///- Or perform the transaction
+        else
+        {
+            //we should send an "item sold" message if the seller is online
+            //we send the item to the winner
+            //we send the money to the seller
+            sAuctionMgr.SendAuctionSuccessfulMail( auction );
+            sAuctionMgr.SendAuctionWonMail( auction );
+        }
+
+        ///- In any case clear the auction
+        expiredIds.push_back(auction->Id);
+        sAuctionMgr.RemoveAItem(auction->item_guidlow);
+        RemoveAuction(auction->Id);
+        delete auction;
+    }
+
+    ///- Delete expired auctions from DB, queued after their mails as before
+    for (size_t start = 0; start < expiredIds.size(); start += AUCTION_DELETE_BATCH_SIZE)
+    {
+        size_t end = std::min(start + AUCTION_DELETE_BATCH_SIZE, expiredIds.size());
+
+        std::ostringstream ss;
+        ss << "DELETE FROM auction WHERE id IN (";
+        for (size_t i = start; i < end; ++i)
+            ss << (i == start ? "" : ",") << expiredIds[i];
+        ss << ")";
+
+        CharacterDatabase.Execute(ss.str().c_str());
+    }
+}
+
+bool AuctionHouseObject::RemoveAuction(uint32 id)
+{
+    AuctionEntryMap::iterator itr = AuctionsMap.find(id);
+    if (itr == AuctionsMap.end())
+        return false;
 
-            ///- In any case clear the auction
-            itr->second->DeleteFromDB();
-            sAuctionMgr.RemoveAItem(itr->second->item_guidlow);
-            delete itr->second;
-            RemoveAuction(itr->first);
+    std::pair<AuctionExpireMap::iterator, AuctionExpireMap::iterator> bounds = AuctionsByExpireTime.equal_range(itr->second->expire_time);
+    for (AuctionExpireMap::iterator expire = bounds.first; expire != bounds.second; ++expire)
+    {
+        if (expire->second == id)
+        {
+            AuctionsByExpireTime.erase(expire);
+            break;
         }
     }
+
+    AuctionsByItemMap::iterator group = AuctionsByItem.find(itr->second->item_template);
+    if (group != AuctionsByItem.end())
+    {
+        group->second.erase(id);
+        if (group->second.empty())
+            AuctionsByItem.erase(group);
+    }
+
+    AuctionsMap.erase(itr);
+    return true;
 }
 
 void AuctionHouseObject::BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount)
@@ -608,15 +657,12 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
 {
     int loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
 
-    for (AuctionEntryMap::const_iterator itr = AuctionsMap.begin();itr != AuctionsMap.end();++itr)
+    for (AuctionsByItemMap::const_iterator group = AuctionsByItem.begin(); group != AuctionsByItem.end(); ++group)
     {
-        AuctionEntry *Aentry = itr->second;
-        Item *item = sAuctionMgr.GetAItem(Aentry->item_guidlow);
-        if (!item)
+        ItemPrototype const *proto = ObjectMgr::GetItemPrototype(group->first);
+        if (!proto)
             continue;
 
-        ItemPrototype const *proto = item->GetProto();
-
         if (itemClass != 0xffffffff && proto->Class != itemClass)
             continue;
 
@@ -632,9 +678,6 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
         if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
             continue;
 
-        if (usable != 0x00 && player->CanUseItem( item ) != EQUIP_ERR_OK)
-            continue;
-
         std::string name = proto->Name1;
         if(name.empty())
             continue;
@@ -653,12 +696,32 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
         if (!wsearchedname.empty() && !Utf8FitTo(name, wsearchedname) )
             continue;
 
-        if (count < 50 && totalcount >= listfrom)
+        AuctionEntryMap const& auctions = group->second;
+
+        // without per item check all auctions of template fit, not listed ones only counted
+        if (usable == 0x00 && (count >= 50 || totalcount + auctions.size() <= listfrom))
+        {
+            totalcount += auctions.size();
+            continue;
+        }
+
+        for (AuctionEntryMap::const_iterator itr = auctions.begin(); itr != auctions.end(); ++itr)
         {
-            ++count;
-            Aentry->BuildAuctionInfo(data);
+            AuctionEntry *Aentry = itr->second;
+            Item *item = sAuctionMgr.GetAItem(Aentry->item_guidlow);
+            if (!item)
+                continue;
+
+            if (usable != 0x00 && player->CanUseItem( item ) != EQUIP_ERR_OK)
+                continue;
+
+            if (count < 50 && totalcount >= listfrom)
+            {
+                ++count;
+                Aentry->BuildAuctionInfo(data);
+            }
+            ++totalcount;
         }
-        ++totalcount;
     }
 }
 
@@ -88,6 +88,8 @@ class AuctionHouseObject
         {
             ASSERT( ah );
             AuctionsMap[ah->Id] = ah;
+            AuctionsByItem[ah->item_template][ah->Id] = ah;
+            AuctionsByExpireTime.insert(AuctionExpireMap::value_type(ah->expire_time, ah->Id));
         }
 
         AuctionEntry* GetAuction(uint32 id) const
@@ -96,10 +98,7 @@ class AuctionHouseObject
             return itr != AuctionsMap.end() ? itr->second : NULL;
         }
 
-        bool RemoveAuction(uint32 id)
-        {
-            return AuctionsMap.erase(id) ? true : false;
-        }
+        bool RemoveAuction(uint32 id);
 
         void Update();
 
@@ -111,7 +110,13 @@ class AuctionHouseObject
             uint32& count, uint32& totalcount);
 
     private:
+        // search filters depend only from item template, so search check them once per template
+        typedef std::map<uint32, AuctionEntryMap> AuctionsByItemMap;
+        typedef std::multimap<time_t, uint32> AuctionExpireMap;
+
         AuctionEntryMap AuctionsMap;
+        AuctionsByItemMap AuctionsByItem;                   // item template -> its auctions
+        AuctionExpireMap AuctionsByExpireTime;              // expire time -> auction id, for visit only expired at update
 };
 
 class AuctionHouseMgr
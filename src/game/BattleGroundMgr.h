@@ -58,6 +58,9 @@ struct GroupQueueInfo                                       // stores informatio
     uint32  IsInvitedToBGInstanceGUID;                      // was invited to certain BG
     uint32  ArenaTeamRating;                                // if rated match, inited to the rating of the team
     uint32  OpponentsTeamRating;                            // for rated arena matches
+    BattleGroundBracketId BracketId;                        // queue where group is queued, for remove without search
+    uint32  QueueIndex;                                     // BattleGroundQueueGroupTypes
+    std::list<GroupQueueInfo*>::iterator QueuePos;          // position in queue
 };
 
 enum BattleGroundQueueGroupTypes
@@ -129,6 +132,9 @@ class BattleGroundQueue
         SelectionPool m_SelectionPools[BG_TEAMS_COUNT];
 
         bool InviteGroupToBG(GroupQueueInfo * ginfo, BattleGround * bg, uint32 side);
+        void AddToQueue(GroupQueueInfo* ginfo, BattleGroundBracketId bracket_id, uint32 index, bool front);
+        void RemoveFromQueue(GroupQueueInfo* ginfo);
+        void MoveToQueue(GroupQueueInfo* ginfo, uint32 index) { RemoveFromQueue(ginfo); AddToQueue(ginfo, ginfo->BracketId, index, true); }
         uint32 m_WaitTimes[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
         uint32 m_WaitTimeLastPlayer[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
         uint32 m_SumOfWaitTimes[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
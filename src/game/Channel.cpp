@@ -106,6 +106,7 @@ void Channel::Join(uint64 p, const char *pass)
 
     PlayerInfo pinfo;
     pinfo.player = p;
+    pinfo.plr = plr;
     pinfo.flags = 0;
     players[p] = pinfo;
 
@@ -665,8 +666,8 @@ void Channel::SendToAll(WorldPacket *data, uint64 p)
 {
     for(PlayerList::const_iterator i = players.begin(); i != players.end(); ++i)
     {
-        Player *plr = sObjectMgr.GetPlayer(i->first);
-        if(plr)
+        Player *plr = i->second.plr;
+        if(plr && plr->IsInWorld())
         {
             if(!p || !plr->GetSocial()->HasIgnore(GUID_LOPART(p)))
                 plr->GetSession()->SendPacket(data);
@@ -680,8 +681,8 @@ void Channel::SendToAllButOne(WorldPacket *data, uint64 who)
     {
         if(i->first != who)
         {
-            Player *plr = sObjectMgr.GetPlayer(i->first);
-            if(plr)
+            Player *plr = i->second.plr;
+            if(plr && plr->IsInWorld())
                 plr->GetSession()->SendPacket(data);
         }
     }
@@ -120,7 +120,10 @@ class Channel
 
     struct PlayerInfo
     {
+        PlayerInfo() : player(0), plr(NULL), flags(0) {}
+
         uint64 player;
+        Player* plr;                                        // joined online, member removed from list at logout
         uint8 flags;
 
         bool HasFlag(uint8 flag) { return flags & flag; }
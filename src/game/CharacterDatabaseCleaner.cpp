@@ -22,6 +22,7 @@
 #include "Database/DatabaseEnv.h"
 #include "DBCStores.h"
 #include "ProgressBar.h"
+#include "Util.h"
 
 void CharacterDatabaseCleaner::CleanDatabase()
 {
@@ -47,6 +48,8 @@ void CharacterDatabaseCleaner::CleanDatabase()
         CleanCharacterSpell();
     if(flags & CLEANING_FLAG_TALENTS)
         CleanCharacterTalent();
+    if(flags & CLEANING_FLAG_DATA_FIELDS)
+        ConvertCharacterDataFields();
     CharacterDatabase.Execute("UPDATE saved_variables SET cleaning_flags = 0");
 }
 
@@ -137,3 +140,61 @@ void CharacterDatabaseCleaner::CleanCharacterTalent()
 
     CheckUnique("talent_id", "character_talent", &TalentCheck);
 }
+
+void CharacterDatabaseCleaner::ConvertDataFieldsColumn(const char* column, const char* table)
+{
+    QueryResult* result = CharacterDatabase.PQuery("SELECT COUNT(*) FROM %s WHERE %s NOT LIKE '%c%%'", table, column, UINT32_ARRAY_COMPACT_MARKER);
+    if(!result)
+        return;
+    uint32 total = (*result)[0].GetUInt32();
+    delete result;
+
+    sLog.outString("Converting %s.%s to compact form...", table, column);
+    barGoLink bar( (int)total );
+
+    // batches by guid, full item_instance content can be too big for load at once
+    uint32 lastGuid = 0;
+    uint32 converted = 0;
+    std::vector<uint32> values;
+    for(;;)
+    {
+        result = CharacterDatabase.PQuery("SELECT guid, %s FROM %s WHERE guid > '%u' AND %s NOT LIKE '%c%%' ORDER BY guid LIMIT 10000",
+            column, table, lastGuid, column, UINT32_ARRAY_COMPACT_MARKER);
+        if(!result)
+            break;
+
+        CharacterDatabase.BeginTransaction();
+        do
+        {
+            bar.step();
+
+            Field *fields = result->Fetch();
+            lastGuid = fields[0].GetUInt32();
+
+            char const* data = fields[1].GetString();
+            uint32 count = UInt32ArrayFromString(data, NULL, 0);
+            if(!count)
+                continue;
+
+            values.resize(count);
+            UInt32ArrayFromString(data, &values[0], count);
+
+            CharacterDatabase.PExecute("UPDATE %s SET %s = '%s' WHERE guid = '%u'",
+                table, column, UInt32ArrayToString(&values[0], count).c_str(), lastGuid);
+            ++converted;
+        }
+        while( result->NextRow() );
+        CharacterDatabase.CommitTransaction();
+        delete result;
+    }
+
+    sLog.outString(">> Converted %u rows", converted);
+}
+
+void CharacterDatabaseCleaner::ConvertCharacterDataFields()
+{
+    ConvertDataFieldsColumn("data", "item_instance");
+    ConvertDataFieldsColumn("exploredZones", "characters");
+    ConvertDataFieldsColumn("equipmentCache", "characters");
+    ConvertDataFieldsColumn("knownTitles", "characters");
+}
@@ -26,7 +26,8 @@ namespace CharacterDatabaseCleaner
         CLEANING_FLAG_ACHIEVEMENT_PROGRESS  = 0x1,
         CLEANING_FLAG_SKILLS                = 0x2,
         CLEANING_FLAG_SPELLS                = 0x4,
-        CLEANING_FLAG_TALENTS               = 0x8
+        CLEANING_FLAG_TALENTS               = 0x8,
+        CLEANING_FLAG_DATA_FIELDS           = 0x10              // convert update field arrays to compact form
     };
 
 
@@ -43,6 +44,9 @@ namespace CharacterDatabaseCleaner
     void CleanCharacterSkills();
     void CleanCharacterSpell();
     void CleanCharacterTalent();
+
+    void ConvertDataFieldsColumn(const char* column, const char* table);
+    void ConvertCharacterDataFields();
 }
 
 #endif
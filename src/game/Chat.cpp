@@ -169,6 +169,16 @@ ChatCommand * ChatHandler::getCommandTable()
         { NULL,             0,                  false, NULL,                                           "", NULL }
     };
 
+    static ChatCommand debugCaptureCommandTable[] =
+    {
+        { "account",        SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleDebugCaptureAccountCommand,      "", NULL },
+        { "opcode",         SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleDebugCaptureOpcodeCommand,       "", NULL },
+        { "start",          SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleDebugCaptureStartCommand,        "", NULL },
+        { "stop",           SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleDebugCaptureStopCommand,         "", NULL },
+        { "",               SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleDebugCaptureCommand,             "", NULL },
+        { NULL,             0,                  false, NULL,                                                "", NULL }
+    };
+
     static ChatCommand debugPlayCommandTable[] =
     {
         { "cinematic",      SEC_MODERATOR,      false, &ChatHandler::HandleDebugPlayCinematicCommand,       "", NULL },
@@ -199,6 +209,7 @@ ChatCommand * ChatHandler::getCommandTable()
         { "anim",           SEC_GAMEMASTER,     false, &ChatHandler::HandleDebugAnimCommand,                "", NULL },
         { "arena",          SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugArenaCommand,               "", NULL },
         { "bg",             SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugBattlegroundCommand,        "", NULL },
+        { "capture",        SEC_ADMINISTRATOR,  true,  NULL,                                                "", debugCaptureCommandTable },
         { "getitemstate",   SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugGetItemStateCommand,        "", NULL },
         { "lootrecipient",  SEC_GAMEMASTER,     false, &ChatHandler::HandleDebugGetLootRecipientCommand,    "", NULL },
         { "getitemvalue",   SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugGetItemValueCommand,        "", NULL },
@@ -589,6 +600,12 @@ ChatCommand * ChatHandler::getCommandTable()
         { NULL,             0,                  false, NULL,                                           "", NULL }
     };
 
+    static ChatCommand serverPersistenceCommandTable[] =
+    {
+        { "stats",          SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerPersistenceStatsCommand, "", NULL },
+        { NULL,             0,                  false, NULL,                                           "", NULL }
+    };
+
     static ChatCommand serverSetCommandTable[] =
     {
         { "motd",           SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerSetMotdCommand,       "", NULL },
@@ -604,6 +621,7 @@ ChatCommand * ChatHandler::getCommandTable()
         { "info",           SEC_PLAYER,         true,  &ChatHandler::HandleServerInfoCommand,          "", NULL },
         { "log",            SEC_CONSOLE,        true,  NULL,                                           "", serverLogCommandTable },
         { "motd",           SEC_PLAYER,         true,  &ChatHandler::HandleServerMotdCommand,          "", NULL },
+        { "persistence",    SEC_ADMINISTRATOR,  true,  NULL,                                           "", serverPersistenceCommandTable },
         { "plimit",         SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerPLimitCommand,        "", NULL },
         { "restart",        SEC_ADMINISTRATOR,  true,  NULL,                                           "", serverRestartCommandTable },
         { "shutdown",       SEC_ADMINISTRATOR,  true,  NULL,                                           "", serverShutdownCommandTable },
@@ -183,6 +183,12 @@ class ChatHandler
         bool HandleDebugSpellModsCommand(char* args);
         bool HandleDebugUpdateWorldStateCommand(char* args);
 
+        bool HandleDebugCaptureCommand(char* args);
+        bool HandleDebugCaptureAccountCommand(char* args);
+        bool HandleDebugCaptureOpcodeCommand(char* args);
+        bool HandleDebugCaptureStartCommand(char* args);
+        bool HandleDebugCaptureStopCommand(char* args);
+
         bool HandleDebugPlayCinematicCommand(char* args);
         bool HandleDebugPlayMovieCommand(char* args);
         bool HandleDebugPlaySoundCommand(char* args);
@@ -460,6 +466,7 @@ class ChatHandler
         bool HandleServerLogFilterCommand(char* args);
         bool HandleServerLogLevelCommand(char* args);
         bool HandleServerMotdCommand(char* args);
+        bool HandleServerPersistenceStatsCommand(char* args);
         bool HandleServerPLimitCommand(char* args);
         bool HandleServerRestartCommand(char* args);
         bool HandleServerSetMotdCommand(char* args);
@@ -196,11 +196,14 @@ bool Corpse::LoadFromDB(uint32 guid, Field *fields)
     SetUInt32Value(CORPSE_FIELD_DISPLAY_ID, gender == GENDER_FEMALE ? info->displayId_f : info->displayId_m);
 
     // Load equipment
-    Tokens data = StrSplit(fields[16].GetCppString(), " ");
+    uint32 equipmentCache[EQUIPMENT_SLOT_END * 2];
+    memset(equipmentCache, 0, sizeof(equipmentCache));
+    UInt32ArrayFromString(fields[16].GetString(), equipmentCache, EQUIPMENT_SLOT_END * 2);
+
     for (uint8 slot = 0; slot < EQUIPMENT_SLOT_END; slot++)
     {
         uint32 visualbase = slot * 2;
-        uint32 item_id = GetUInt32ValueFromArray(data, visualbase);
+        uint32 item_id = equipmentCache[visualbase];
         const ItemPrototype * proto = ObjectMgr::GetItemPrototype(item_id);
         if(!proto)
         {
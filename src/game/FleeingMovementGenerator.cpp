@@ -37,11 +37,13 @@ FleeingMovementGenerator<T>::_setTargetLocation(T &owner)
     if (owner.hasUnitState(UNIT_STAT_CAN_NOT_REACT & ~UNIT_STAT_FLEEING))
         return;
 
+    i_pathFinder.Clear();
+
     if(!_setMoveData(owner))
         return;
 
     float x, y, z;
-    if(!_getPoint(owner, x, y, z))
+    if(!_getPathPoint(owner, x, y, z) && !_getPoint(owner, x, y, z))
         return;
 
     owner.addUnitState(UNIT_STAT_FLEEING_MOVE);
@@ -183,6 +185,33 @@ FleeingMovementGenerator<T>::_getPoint(T &owner, float &x, float &y, float &z)
     return false;
 }
 
+template<class T>
+bool
+FleeingMovementGenerator<T>::_getPathPoint(T &owner, float &x, float &y, float &z)
+{
+    if (!owner.GetMap()->GetMoveMap())
+        return false;
+
+    // with navigation data run at once to wanted distance, path will go around obstacles
+    float distance = i_to_distance_from_caster - i_last_distance_from_caster;
+    if (distance < 5.0f)
+        distance = 5.0f;
+
+    x = owner.GetPositionX() + distance * cos(i_cur_angle);
+    y = owner.GetPositionY() + distance * sin(i_cur_angle);
+    MaNGOS::NormalizeMapCoord(x);
+    MaNGOS::NormalizeMapCoord(y);
+
+    z = owner.GetBaseMap()->GetHeight(x, y, owner.GetPositionZ() + distance, true);
+    if (z <= INVALID_HEIGHT)
+        return false;
+
+    if (!i_pathFinder.Calculate(owner, x, y, z))
+        return false;
+
+    return i_pathFinder.GetNextPoint(x, y, z);
+}
+
 template<class T>
 bool
 FleeingMovementGenerator<T>::_setMoveData(T &owner)
@@ -379,6 +408,16 @@ bool FleeingMovementGenerator<T>::Update(T &owner, const uint32 & time_diff)
             return true;                                    // not expire now, but already lost
 
         i_destinationHolder.ResetUpdate(50);
+
+        // reached intermediate path point, continue to next one
+        if (i_destinationHolder.HasArrived() && i_pathFinder.HasNextPoint())
+        {
+            float x, y, z;
+            i_pathFinder.GetNextPoint(x, y, z);
+            i_destinationHolder.SetDestination(traveller, x, y, z);
+            return true;
+        }
+
         if(i_nextCheckTime.Passed() && i_destinationHolder.HasArrived())
         {
             _setTargetLocation(owner);
@@ -394,6 +433,8 @@ template bool FleeingMovementGenerator<Player>::_setMoveData(Player &);
 template bool FleeingMovementGenerator<Creature>::_setMoveData(Creature &);
 template bool FleeingMovementGenerator<Player>::_getPoint(Player &, float &, float &, float &);
 template bool FleeingMovementGenerator<Creature>::_getPoint(Creature &, float &, float &, float &);
+template bool FleeingMovementGenerator<Player>::_getPathPoint(Player &, float &, float &, float &);
+template bool FleeingMovementGenerator<Creature>::_getPathPoint(Creature &, float &, float &, float &);
 template void FleeingMovementGenerator<Player>::_setTargetLocation(Player &);
 template void FleeingMovementGenerator<Creature>::_setTargetLocation(Creature &);
 template void FleeingMovementGenerator<Player>::Interrupt(Player &);
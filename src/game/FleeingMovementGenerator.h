@@ -22,6 +22,7 @@
 #include "MovementGenerator.h"
 #include "DestinationHolder.h"
 #include "Traveller.h"
+#include "MoveMap.h"
 
 template<class T>
 class MANGOS_DLL_SPEC FleeingMovementGenerator
@@ -41,6 +42,7 @@ class MANGOS_DLL_SPEC FleeingMovementGenerator
     private:
         void _setTargetLocation(T &owner);
         bool _getPoint(T &owner, float &x, float &y, float &z);
+        bool _getPathPoint(T &owner, float &x, float &y, float &z);
         bool _setMoveData(T &owner);
         void _Init(T &);
 
@@ -58,6 +60,7 @@ class MANGOS_DLL_SPEC FleeingMovementGenerator
         TimeTracker i_nextCheckTime;
 
         DestinationHolder< Traveller<T> > i_destinationHolder;
+        PathFinder i_pathFinder;
 };
 
 class MANGOS_DLL_SPEC TimedFleeingMovementGenerator
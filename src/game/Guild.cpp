@@ -171,6 +171,9 @@ bool Guild::AddMember(uint64 plGuid, uint32 plRank)
         newmember.BankResetTimeTab[i] = 0;
     members[GUID_LOPART(plGuid)] = newmember;
 
+    if (pl)
+        m_onlineMembers[GUID_LOPART(plGuid)] = pl;
+
     std::string dbPnote   = newmember.Pnote;
     std::string dbOFFnote = newmember.OFFnote;
     CharacterDatabase.escape_string(dbPnote);
@@ -496,6 +499,7 @@ void Guild::DelMember(uint64 guid, bool isDisbanding)
     }
 
     members.erase(GUID_LOPART(guid));
+    m_onlineMembers.erase(GUID_LOPART(guid));
 
     Player *player = sObjectMgr.GetPlayer(guid);
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
@@ -549,6 +553,14 @@ void Guild::SetOFFNOTE(uint64 guid,std::string offnote)
     CharacterDatabase.PExecute("UPDATE guild_member SET offnote = '%s' WHERE guid = '%u'", offnote.c_str(), itr->first);
 }
 
+void Guild::SetMemberOnline(Player* player, bool online)
+{
+    if (online)
+        m_onlineMembers[player->GetGUIDLow()] = player;
+    else
+        m_onlineMembers.erase(player->GetGUIDLow());
+}
+
 void Guild::BroadcastToGuild(WorldSession *session, const std::string& msg, uint32 language)
 {
     if (session && session->GetPlayer() && HasRankRight(session->GetPlayer()->GetRank(),GR_RIGHT_GCHATSPEAK))
@@ -556,11 +568,11 @@ void Guild::BroadcastToGuild(WorldSession *session, const std::string& msg, uint
         WorldPacket data;
         ChatHandler(session).FillMessageData(&data, CHAT_MSG_GUILD, language, 0, msg.c_str());
 
-        for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+        for (OnlineMemberMap::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
         {
-            Player *pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+            Player *pl = itr->second;
 
-            if (pl && pl->GetSession() && HasRankRight(pl->GetRank(),GR_RIGHT_GCHATLISTEN) && !pl->GetSocial()->HasIgnore(session->GetPlayer()->GetGUIDLow()) )
+            if (pl->IsInWorld() && pl->GetSession() && HasRankRight(pl->GetRank(),GR_RIGHT_GCHATLISTEN) && !pl->GetSocial()->HasIgnore(session->GetPlayer()->GetGUIDLow()) )
                 pl->GetSession()->SendPacket(&data);
         }
     }
@@ -570,14 +582,14 @@ void Guild::BroadcastToOfficers(WorldSession *session, const std::string& msg, u
 {
     if (session && session->GetPlayer() && HasRankRight(session->GetPlayer()->GetRank(), GR_RIGHT_OFFCHATSPEAK))
     {
-        for(MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
-        {
-            WorldPacket data;
-            ChatHandler::FillMessageData(&data, session, CHAT_MSG_OFFICER, language, NULL, 0, msg.c_str(), NULL);
+        WorldPacket data;
+        ChatHandler::FillMessageData(&data, session, CHAT_MSG_OFFICER, language, NULL, 0, msg.c_str(), NULL);
 
-            Player *pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+        for(OnlineMemberMap::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
+        {
+            Player *pl = itr->second;
 
-            if (pl && pl->GetSession() && HasRankRight(pl->GetRank(),GR_RIGHT_OFFCHATLISTEN) && !pl->GetSocial()->HasIgnore(session->GetPlayer()->GetGUIDLow()))
+            if (pl->IsInWorld() && pl->GetSession() && HasRankRight(pl->GetRank(),GR_RIGHT_OFFCHATLISTEN) && !pl->GetSocial()->HasIgnore(session->GetPlayer()->GetGUIDLow()))
                 pl->GetSession()->SendPacket(&data);
         }
     }
@@ -585,22 +597,23 @@ void Guild::BroadcastToOfficers(WorldSession *session, const std::string& msg, u
 
 void Guild::BroadcastPacket(WorldPacket *packet)
 {
-    for(MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    for(OnlineMemberMap::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
     {
-        Player *player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-        if (player)
+        Player *player = itr->second;
+        if (player->IsInWorld())
             player->GetSession()->SendPacket(packet);
     }
 }
 
 void Guild::BroadcastPacketToRank(WorldPacket *packet, uint32 rankId)
 {
-    for(MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    for(OnlineMemberMap::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
     {
-        if (itr->second.RankId == rankId)
+        MemberList::const_iterator member = members.find(itr->first);
+        if (member != members.end() && member->second.RankId == rankId)
         {
-            Player *player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-            if (player)
+            Player *player = itr->second;
+            if (player->IsInWorld())
                 player->GetSession()->SendPacket(packet);
         }
     }
@@ -1004,10 +1017,10 @@ void Guild::DisplayGuildBankContentUpdate(uint8 TabId, int32 slot1, int32 slot2)
         AppendDisplayGuildBankSlot(data, tab, slot2);
     }
 
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    for (OnlineMemberMap::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
     {
-        Player *player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-        if (!player)
+        Player *player = itr->second;
+        if (!player->IsInWorld())
             continue;
 
         if (!IsMemberHaveRights(itr->first,TabId,GUILD_BANK_RIGHT_VIEW_TAB))
@@ -1039,10 +1052,10 @@ void Guild::DisplayGuildBankContentUpdate(uint8 TabId, GuildItemPosCountVec cons
     for (GuildItemPosCountVec::const_iterator itr = slots.begin(); itr != slots.end(); ++itr)
         AppendDisplayGuildBankSlot(data, tab, itr->Slot);
 
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    for (OnlineMemberMap::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
     {
-        Player *player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-        if (!player)
+        Player *player = itr->second;
+        if (!player->IsInWorld())
             continue;
 
         if (!IsMemberHaveRights(itr->first,TabId,GUILD_BANK_RIGHT_VIEW_TAB))
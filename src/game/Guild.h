@@ -24,6 +24,7 @@
 
 #include "Common.h"
 #include "Item.h"
+#include "Utilities/UnorderedMap.h"
 
 class Item;
 
@@ -317,6 +318,7 @@ class Guild
         bool AddMember(uint64 plGuid, uint32 plRank);
         void ChangeRank(uint64 guid, uint32 newRank);
         void DelMember(uint64 guid, bool isDisbanding = false);
+        void SetMemberOnline(Player* player, bool online);
         //lowest rank is the count of ranks - 1 (the highest rank_id in table)
         uint32 GetLowestRank() const { return m_Ranks.size() - 1; }
 
@@ -453,6 +455,10 @@ class Guild
 
         MemberList members;
 
+        // online members for broadcasts without global player lookup, updated at login/logout and member add/remove
+        typedef UNORDERED_MAP<uint32, Player*> OnlineMemberMap;
+        OnlineMemberMap m_onlineMembers;
+
         typedef std::vector<GuildBankTab*> TabListMap;
         TabListMap m_TabListMap;
 
@@ -50,7 +50,18 @@ HomeMovementGenerator<Creature>::_setTargetLocation(Creature & owner)
 
     CreatureTraveller traveller(owner);
 
-    uint32 travel_time = i_destinationHolder.SetDestination(traveller, x, y, z);
+    uint32 travel_time;
+    // return by navigation path if available, travel time must cover whole way
+    if (i_pathFinder.Calculate(owner, x, y, z))
+    {
+        float length = i_pathFinder.GetLength(owner);
+        i_pathFinder.GetNextPoint(x, y, z);
+        i_destinationHolder.SetDestination(traveller, x, y, z);
+        travel_time = uint32(length / (traveller.Speed() * 0.001f));
+    }
+    else
+        travel_time = i_destinationHolder.SetDestination(traveller, x, y, z);
+
     modifyTravelTime(travel_time);
     owner.clearUnitState(UNIT_STAT_ALL_STATE);
 }
@@ -63,6 +74,11 @@ HomeMovementGenerator<Creature>::Update(Creature &owner, const uint32& time_diff
     {
         if (!IsActive(owner))                               // force stop processing (movement can move out active zone with cleanup movegens list)
             return true;                                    // not expire now, but already lost
+
+        // reached intermediate path point, continue to next one
+        float x, y, z;
+        if (i_destinationHolder.HasArrived() && i_pathFinder.GetNextPoint(x, y, z))
+            i_destinationHolder.SetDestination(traveller, x, y, z);
     }
 
     if (time_diff > i_travel_timer)
@@ -22,6 +22,7 @@
 #include "MovementGenerator.h"
 #include "DestinationHolder.h"
 #include "Traveller.h"
+#include "MoveMap.h"
 
 class Creature;
 
@@ -49,6 +50,7 @@ class MANGOS_DLL_SPEC HomeMovementGenerator<Creature>
     private:
         void _setTargetLocation(Creature &);
         DestinationHolder< Traveller<Creature> > i_destinationHolder;
+        PathFinder i_pathFinder;
 
         uint32 i_travel_timer;
 };
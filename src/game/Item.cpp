@@ -23,6 +23,7 @@
 #include "WorldPacket.h"
 #include "Database/DatabaseEnv.h"
 #include "ItemEnchantmentMgr.h"
+#include "PersistenceMgr.h"
 
 void AddItemsSetItem(Player*player,Item *item)
 {
@@ -299,32 +300,41 @@ void Item::SaveToDB()
         {
             std::string text = m_text;
             CharacterDatabase.escape_string(text);
+            sPersistenceMgr.Discard(PERSISTENCE_ITEM_INSTANCE, guid);
             CharacterDatabase.PExecute( "DELETE FROM item_instance WHERE guid = '%u'", guid );
             std::ostringstream ss;
             ss << "INSERT INTO item_instance (guid,owner_guid,data,text) VALUES (" << guid << "," << GUID_LOPART(GetOwnerGUID()) << ",'";
-            for(uint16 i = 0; i < m_valuesCount; ++i )
-                ss << GetUInt32Value(i) << " ";
+            ss << GetValuesString();
             ss << "', '" << text << "')";
             CharacterDatabase.Execute( ss.str().c_str() );
         } break;
         case ITEM_CHANGED:
         {
-            std::string text = m_text;
-            CharacterDatabase.escape_string(text);
-            std::ostringstream ss;
-            ss << "UPDATE item_instance SET data = '";
-            for(uint16 i = 0; i < m_valuesCount; ++i )
-                ss << GetUInt32Value(i) << " ";
-            ss << "', owner_guid = '" << GUID_LOPART(GetOwnerGUID());
-            ss << "', text = '" << text << "' WHERE guid = '" << guid << "'";
-
-            CharacterDatabase.Execute( ss.str().c_str() );
+            // in player save rows written by multi-row statements before transaction commit
+            if (sPersistenceMgr.IsBatching())
+            {
+                sPersistenceMgr.SetString(PERSISTENCE_ITEM_INSTANCE, guid, ITEM_INSTANCE_DATA, GetValuesString());
+                sPersistenceMgr.SetUInt32(PERSISTENCE_ITEM_INSTANCE, guid, ITEM_INSTANCE_OWNER_GUID, GUID_LOPART(GetOwnerGUID()));
+                sPersistenceMgr.SetString(PERSISTENCE_ITEM_INSTANCE, guid, ITEM_INSTANCE_TEXT, m_text);
+            }
+            else
+            {
+                std::string text = m_text;
+                CharacterDatabase.escape_string(text);
+                std::ostringstream ss;
+                ss << "UPDATE item_instance SET data = '" << GetValuesString();
+                ss << "', owner_guid = '" << GUID_LOPART(GetOwnerGUID());
+                ss << "', text = '" << text << "' WHERE guid = '" << guid << "'";
+
+                CharacterDatabase.Execute( ss.str().c_str() );
+            }
 
             if(HasFlag(ITEM_FIELD_FLAGS, ITEM_FLAGS_WRAPPED))
                 CharacterDatabase.PExecute("UPDATE character_gifts SET guid = '%u' WHERE item_guid = '%u'", GUID_LOPART(GetOwnerGUID()),GetGUIDLow());
         } break;
         case ITEM_REMOVED:
         {
+            sPersistenceMgr.Discard(PERSISTENCE_ITEM_INSTANCE, guid);
             CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid = '%u'", guid);
             if(HasFlag(ITEM_FIELD_FLAGS, ITEM_FLAGS_WRAPPED))
                 CharacterDatabase.PExecute("DELETE FROM character_gifts WHERE item_guid = '%u'", GetGUIDLow());
@@ -422,9 +432,7 @@ bool Item::LoadFromDB(uint32 guid, uint64 owner_guid, QueryResult *result)
     if (need_save)                                          // normal item changed state set not work at loading
     {
         std::ostringstream ss;
-        ss << "UPDATE item_instance SET data = '";
-        for(uint16 i = 0; i < m_valuesCount; ++i )
-            ss << GetUInt32Value(i) << " ";
+        ss << "UPDATE item_instance SET data = '" << GetValuesString();
         ss << "', owner_guid = '" << GUID_LOPART(GetOwnerGUID()) << "' WHERE guid = '" << guid << "'";
 
         CharacterDatabase.Execute( ss.str().c_str() );
@@ -435,6 +443,7 @@ bool Item::LoadFromDB(uint32 guid, uint64 owner_guid, QueryResult *result)
 
 void Item::DeleteFromDB()
 {
+    sPersistenceMgr.Discard(PERSISTENCE_ITEM_INSTANCE, GetGUIDLow());
     CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid = '%u'",GetGUIDLow());
 }
 
@@ -52,6 +52,8 @@
 #include "InstanceData.h"
 #include "CreatureEventAIMgr.h"
 #include "DBCEnums.h"
+#include "PersistenceMgr.h"
+#include "PlayerSaveScheduler.h"
 
 //reload commands
 bool ChatHandler::HandleReloadAllCommand(char* /*args*/)
@@ -588,6 +590,7 @@ bool ChatHandler::HandleReloadSpellProcEventCommand(char* /*args*/)
 {
     sLog.outString( "Re-Loading Spell Proc Event conditions..." );
     sSpellMgr.LoadSpellProcEvents();
+    // proc flags added to spells without proc flags apply only to auras applied after reload
     SendGlobalSysMessage("DB table `spell_proc_event` (spell proc trigger requirements) reloaded.");
     return true;
 }
@@ -5947,6 +5950,23 @@ bool ChatHandler::HandleServerPLimitCommand(char *args)
     return true;
 }
 
+bool ChatHandler::HandleServerPersistenceStatsCommand(char* /*args*/)
+{
+    PSendSysMessage("Player saves: %u, statements executed: " UI64FMTD ", rows written: " UI64FMTD ".",
+        Player::GetTotalSaves(), Player::GetTotalSaveStatements(), Player::GetTotalSaveRows());
+
+    PersistenceStats stats = sPersistenceMgr.GetStats();
+
+    PSendSysMessage("Batched item field changes: " UI64FMTD ", coalesced into pending rows: " UI64FMTD ".", stats.fieldWrites, stats.coalescedWrites);
+    PSendSysMessage("Player saves with batched rows: %u, rows written: " UI64FMTD " by " UI64FMTD " statements.",
+        stats.batches, stats.rowsWritten, stats.statements);
+
+    PlayerSaveSchedulerStats saveStats = sPlayerSaveScheduler.GetStats();
+    PSendSysMessage("Autosave backlog: %u players, oldest waiting %u ms, avg wait %u ms, ticks with postponed saves: %u.",
+        saveStats.backlog, saveStats.oldestWait, saveStats.saves ? uint32(saveStats.sumWait / saveStats.saves) : 0, saveStats.limitedTicks);
+    return true;
+}
+
 bool ChatHandler::HandleCastCommand(char* args)
 {
     if (!*args)
@@ -37,6 +37,7 @@
 #include "MapInstanced.h"
 #include "InstanceSaveMgr.h"
 #include "VMapFactory.h"
+#include "MoveMap.h"
 #include "BattleGroundMgr.h"
 
 struct ScriptAction
@@ -57,6 +58,8 @@ Map::~Map()
 
     if (m_instanceSave)
         m_instanceSave->SetUsedByMapState(false);           // field pointer can be deleted after this
+
+    delete m_moveMap;
 }
 
 void Map::LoadVMap(int gx,int gy)
@@ -117,6 +120,9 @@ void Map::LoadMap(int gx,int gy, bool reload)
         sLog.outError("Error load map file: \n %s\n", tmp);
     }
     delete [] tmp;
+
+    if (m_moveMap)
+        m_moveMap->LoadTile(gx, gy);
 }
 
 void Map::LoadMapAndVMap(int gx,int gy)
@@ -131,7 +137,7 @@ Map::Map(uint32 id, time_t expiry, uint32 InstanceId, uint8 SpawnMode, Map* _par
   i_id(id), i_InstanceId(InstanceId), m_unloadTimer(0),
   m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), m_instanceSave(NULL),
   m_activeNonPlayersIter(m_activeNonPlayers.end()),
-  i_gridExpiry(expiry), m_parentMap(_parent ? _parent : this)
+  i_gridExpiry(expiry), m_parentMap(_parent ? _parent : this), m_moveMap(NULL)
 {
     for(unsigned int idx=0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
     {
@@ -144,6 +150,10 @@ Map::Map(uint32 id, time_t expiry, uint32 InstanceId, uint8 SpawnMode, Map* _par
     }
     ObjectAccessor::LinkMap(this);
 
+    // navigation data loaded only for base map and shared with instances like grid maps
+    if (m_parentMap == this && sWorld.getConfig(CONFIG_BOOL_PATHFINDING_ENABLED))
+        m_moveMap = new MoveMap(id);
+
     //lets initialize visibility distance for map
     Map::InitVisibilityDistance();
 }
@@ -953,6 +963,8 @@ bool Map::UnloadGrid(const uint32 &x, const uint32 &y, bool pForce)
                 delete GridMaps[gx][gy];
             }
             VMAP::VMapFactory::createOrGetVMapManager()->unloadMap(GetId(), gx, gy);
+            if (m_moveMap)
+                m_moveMap->UnloadTile(gx, gy);
         }
         else
             ((MapInstanced*)m_parentMap)->RemoveGridMapReference(GridPair(gx, gy));
@@ -39,6 +39,7 @@
 #include <list>
 
 class Creature;
+class MoveMap;
 class Unit;
 class WorldPacket;
 class InstanceData;
@@ -150,6 +151,9 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>, public MaNGOS::Obj
 
         Map const * GetParent() const { return m_parentMap; }
 
+        // navigation data shared with parent map, can be NULL if path finding disabled
+        MoveMap* GetMoveMap() const { return m_parentMap->m_moveMap; }
+
         // some calls like isInWater should not use vmaps due to processor power
         // can return INVALID_HEIGHT if under z+2 z coord not found height
         float GetHeight(float x, float y, float z, bool pCheckVMap=true, float maxSearchDist=DEFAULT_HEIGHT_SEARCH) const;
@@ -338,6 +342,7 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>, public MaNGOS::Obj
 
         NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         GridMap *GridMaps[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+        MoveMap* m_moveMap;                                 // only for base maps, instances use parent map data
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
 
         std::set<WorldObject *> i_objectsToRemove;
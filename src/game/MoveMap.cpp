@@ -0,0 +1,478 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "MoveMap.h"
+#include "Log.h"
+#include "World.h"
+#include "Map.h"
+#include "Unit.h"
+#include "Creature.h"
+#include "DBCStores.h"
+
+#include <queue>
+#include <algorithm>
+
+char const* MMAP_FILE_MAGIC         = MMAP_MAGIC;
+char const* MMAP_FILE_VERSION_MAGIC = MMAP_VERSION_MAGIC;
+
+// cell index in whole map cell space
+#define MMAP_CELL_INDEX(cx, cy)     ((cx) * MMAP_MAX_CELLS + (cy))
+#define MMAP_CELL_X(idx)            ((idx) / MMAP_MAX_CELLS)
+#define MMAP_CELL_Y(idx)            ((idx) % MMAP_MAX_CELLS)
+
+static inline bool ComputeCell(float x, float y, uint32& cx, uint32& cy)
+{
+    float fx = MMAP_CELLS_PER_GRID * (32 - x / MMAP_GRID_SIZE);
+    float fy = MMAP_CELLS_PER_GRID * (32 - y / MMAP_GRID_SIZE);
+
+    if (fx < 0.0f || fy < 0.0f || fx >= MMAP_MAX_CELLS || fy >= MMAP_MAX_CELLS)
+        return false;
+
+    cx = uint32(fx);
+    cy = uint32(fy);
+    return true;
+}
+
+static inline void ComputeCellCenter(uint32 cx, uint32 cy, float& x, float& y)
+{
+    x = (32 - (cx + 0.5f) / MMAP_CELLS_PER_GRID) * MMAP_GRID_SIZE;
+    y = (32 - (cy + 0.5f) / MMAP_CELLS_PER_GRID) * MMAP_GRID_SIZE;
+}
+
+static inline bool CanPassCell(MoveMapCell const* cell, bool canSwim)
+{
+    if (!cell || (cell->flags & MMAP_CELL_NO_GROUND))
+        return false;
+
+    return canSwim || !(cell->flags & MMAP_CELL_WATER);
+}
+
+//-----------------------------------------------//
+bool MoveMapTile::loadData(char const* filename)
+{
+    unloadData();
+
+    FILE* in = fopen(filename, "rb");
+    if (!in)
+        return false;
+
+    MoveMapFileHeader header;
+    if (fread(&header, sizeof(header), 1, in) != 1 ||
+        header.mmapMagic != *((uint32 const*)(MMAP_FILE_MAGIC)) ||
+        header.versionMagic != *((uint32 const*)(MMAP_FILE_VERSION_MAGIC)) ||
+        header.cellsPerGrid != MMAP_CELLS_PER_GRID ||
+        !IsAcceptableClientBuild(header.buildMagic))
+    {
+        sLog.outError("Move map file '%s' is non-compatible version (outdated?). Please, create new using mmap_generator.", filename);
+        fclose(in);
+        return false;
+    }
+
+    m_cells = new MoveMapCell[MMAP_CELLS_PER_GRID * MMAP_CELLS_PER_GRID];
+    if (fread(m_cells, sizeof(MoveMapCell), MMAP_CELLS_PER_GRID * MMAP_CELLS_PER_GRID, in) != MMAP_CELLS_PER_GRID * MMAP_CELLS_PER_GRID)
+    {
+        sLog.outError("Move map file '%s' is corrupted.", filename);
+        unloadData();
+        fclose(in);
+        return false;
+    }
+
+    fclose(in);
+    return true;
+}
+
+void MoveMapTile::unloadData()
+{
+    delete[] m_cells;
+    m_cells = NULL;
+}
+
+//-----------------------------------------------//
+MoveMap::MoveMap(uint32 mapId) : i_mapId(mapId), i_generation(0)
+{
+    for (int i = 0; i < MMAP_MAX_GRIDS; ++i)
+        for (int j = 0; j < MMAP_MAX_GRIDS; ++j)
+            i_tiles[i][j] = NULL;
+}
+
+MoveMap::~MoveMap()
+{
+    for (int i = 0; i < MMAP_MAX_GRIDS; ++i)
+        for (int j = 0; j < MMAP_MAX_GRIDS; ++j)
+            delete i_tiles[i][j];
+}
+
+void MoveMap::LoadTile(int gx, int gy)
+{
+    // load file outside lock, path queries must not wait disk access
+    char fileName[1024];
+    snprintf(fileName, sizeof(fileName), "%smmaps/%03u%02u%02u.mmtile", sWorld.GetDataPath().c_str(), i_mapId, gx, gy);
+
+    MoveMapTile* tile = new MoveMapTile;
+    if (!tile->loadData(fileName))
+    {
+        DEBUG_LOG("No move map tile %s, straight line movement will be used", fileName);
+        delete tile;
+        return;
+    }
+
+    DETAIL_LOG("Loaded move map tile %s", fileName);
+
+    WriteGuard guard(i_tilesLock);
+    delete i_tiles[gx][gy];
+    i_tiles[gx][gy] = tile;
+    ++i_generation;
+}
+
+void MoveMap::UnloadTile(int gx, int gy)
+{
+    MoveMapTile* tile;
+    {
+        WriteGuard guard(i_tilesLock);
+        tile = i_tiles[gx][gy];
+        i_tiles[gx][gy] = NULL;
+        if (tile)
+            ++i_generation;
+    }
+
+    delete tile;
+}
+
+MoveMapCell const* MoveMap::GetCell(uint32 cx, uint32 cy) const
+{
+    if (cx >= MMAP_MAX_CELLS || cy >= MMAP_MAX_CELLS)
+        return NULL;
+
+    MoveMapTile const* tile = i_tiles[cx / MMAP_CELLS_PER_GRID][cy / MMAP_CELLS_PER_GRID];
+    return tile ? tile->getCell(cx % MMAP_CELLS_PER_GRID, cy % MMAP_CELLS_PER_GRID) : NULL;
+}
+
+bool MoveMap::IsDirectPath(uint32 fromCell, uint32 toCell, bool canSwim) const
+{
+    int32 cx = MMAP_CELL_X(fromCell);
+    int32 cy = MMAP_CELL_Y(fromCell);
+    int32 const tx = MMAP_CELL_X(toCell);
+    int32 const ty = MMAP_CELL_Y(toCell);
+
+    int32 const dx = abs(tx - cx);
+    int32 const dy = abs(ty - cy);
+    int32 const sx = cx < tx ? 1 : -1;
+    int32 const sy = cy < ty ? 1 : -1;
+
+    // bresenham walk, every step must use existed link between cells
+    int32 err = dx - dy;
+    MoveMapCell const* cell = GetCell(cx, cy);
+    while (cx != tx || cy != ty)
+    {
+        if (!CanPassCell(cell, canSwim))
+            return false;
+
+        int32 stepX = 0, stepY = 0;
+        int32 const err2 = 2 * err;
+        if (err2 > -dy)
+        {
+            err -= dy;
+            stepX = sx;
+        }
+        if (err2 < dx)
+        {
+            err += dx;
+            stepY = sy;
+        }
+
+        int dir = 0;
+        for (; dir < MMAP_DIR_COUNT; ++dir)
+            if (MoveMapDirOffsetX[dir] == stepX && MoveMapDirOffsetY[dir] == stepY)
+                break;
+
+        if (!(cell->links & (1 << dir)))
+            return false;
+
+        cx += stepX;
+        cy += stepY;
+        cell = GetCell(cx, cy);
+    }
+
+    return CanPassCell(cell, canSwim);
+}
+
+struct PathSearchNode
+{
+    PathSearchNode() : cost(0.0f), parent(0), closed(false) {}
+    PathSearchNode(float _cost, uint32 _parent) : cost(_cost), parent(_parent), closed(false) {}
+
+    float cost;
+    uint32 parent;
+    bool closed;
+};
+
+bool MoveMap::SearchPath(uint32 srcCell, uint32 dstCell, bool canSwim, CellList& cells) const
+{
+    typedef UNORDERED_MAP<uint32, PathSearchNode> NodeMap;
+    typedef std::pair<float, uint32> OpenEntry;
+    typedef std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<OpenEntry> > OpenList;
+
+    int32 const dstX = MMAP_CELL_X(dstCell);
+    int32 const dstY = MMAP_CELL_Y(dstCell);
+
+    NodeMap nodes;
+    OpenList open;
+
+    nodes[srcCell] = PathSearchNode(0.0f, srcCell);
+    open.push(OpenEntry(0.0f, srcCell));
+
+    // bound search CPU, unreachable or too far destination will use straight line
+    uint32 budget = sWorld.getConfig(CONFIG_UINT32_PATHFINDING_MAX_NODES);
+
+    while (!open.empty() && budget)
+    {
+        uint32 const curCell = open.top().second;
+        open.pop();
+
+        PathSearchNode& cur = nodes[curCell];
+        if (cur.closed)
+            continue;
+
+        if (curCell == dstCell)
+        {
+            for (uint32 idx = dstCell; idx != srcCell; idx = nodes[idx].parent)
+                cells.push_back(idx);
+            cells.push_back(srcCell);
+            std::reverse(cells.begin(), cells.end());
+            return true;
+        }
+
+        cur.closed = true;
+        --budget;
+
+        int32 const cx = MMAP_CELL_X(curCell);
+        int32 const cy = MMAP_CELL_Y(curCell);
+        MoveMapCell const* cell = GetCell(cx, cy);
+        float const curCost = cur.cost;
+
+        for (int dir = 0; dir < MMAP_DIR_COUNT; ++dir)
+        {
+            if (!(cell->links & (1 << dir)))
+                continue;
+
+            int32 const nx = cx + MoveMapDirOffsetX[dir];
+            int32 const ny = cy + MoveMapDirOffsetY[dir];
+            if (!CanPassCell(GetCell(nx, ny), canSwim))
+                continue;
+
+            uint32 const nextCell = MMAP_CELL_INDEX(nx, ny);
+            float const cost = curCost + ((dir & 1) ? M_SQRT2 : 1.0f);
+
+            NodeMap::iterator itr = nodes.find(nextCell);
+            if (itr != nodes.end())
+            {
+                if (itr->second.closed || itr->second.cost <= cost)
+                    continue;
+
+                itr->second.cost = cost;
+                itr->second.parent = curCell;
+            }
+            else
+                nodes[nextCell] = PathSearchNode(cost, curCell);
+
+            // octile distance heuristic
+            float const hx = float(abs(dstX - nx));
+            float const hy = float(abs(dstY - ny));
+            float const heuristic = hx > hy ? hx + (M_SQRT2 - 1.0f) * hy : hy + (M_SQRT2 - 1.0f) * hx;
+
+            open.push(OpenEntry(cost + heuristic, nextCell));
+        }
+    }
+
+    return false;
+}
+
+bool MoveMap::FindPath(float srcX, float srcY, float srcZ, float dstX, float dstY, float dstZ, bool canSwim, SimplePath& path)
+{
+    uint32 srcCX, srcCY, dstCX, dstCY;
+    if (!ComputeCell(srcX, srcY, srcCX, srcCY) || !ComputeCell(dstX, dstY, dstCX, dstCY))
+        return false;
+
+    uint32 const srcCell = MMAP_CELL_INDEX(srcCX, srcCY);
+    uint32 const dstCell = MMAP_CELL_INDEX(dstCX, dstCY);
+    uint64 const cacheKey = (uint64(srcCell) << 27) | (uint64(dstCell) << 1) | (canSwim ? 1 : 0);
+
+    CellList cells;
+    uint32 generation;
+    {
+        ReadGuard guard(i_tilesLock);
+
+        generation = i_generation;
+
+        if (GetCachedPath(cacheKey, generation, path))
+        {
+            SimplePathNode& last = path[path.size() - 1];
+            last.x = dstX;
+            last.y = dstY;
+            last.z = dstZ;
+            return true;
+        }
+
+        if (!CanPassCell(GetCell(srcCX, srcCY), canSwim) || !CanPassCell(GetCell(dstCX, dstCY), canSwim))
+            return false;
+
+        if (IsDirectPath(srcCell, dstCell, canSwim))
+        {
+            cells.push_back(srcCell);
+            cells.push_back(dstCell);
+        }
+        else
+        {
+            if (!SearchPath(srcCell, dstCell, canSwim, cells))
+                return false;
+
+            // string pulling: keep only cells where direct walk is broken
+            CellList smooth;
+            smooth.push_back(cells[0]);
+            size_t anchor = 0;
+            for (size_t i = 2; i < cells.size(); ++i)
+            {
+                if (!IsDirectPath(cells[anchor], cells[i], canSwim))
+                {
+                    anchor = i - 1;
+                    smooth.push_back(cells[anchor]);
+                }
+            }
+            smooth.push_back(cells.back());
+            cells.swap(smooth);
+        }
+
+        path.resize(cells.size() - 1);
+        for (size_t i = 1; i < cells.size(); ++i)
+        {
+            SimplePathNode& node = path[i - 1];
+            uint32 const cx = MMAP_CELL_X(cells[i]);
+            uint32 const cy = MMAP_CELL_Y(cells[i]);
+            ComputeCellCenter(cx, cy, node.x, node.y);
+            node.z = GetCell(cx, cy)->height;
+        }
+    }
+
+    SimplePathNode& last = path[path.size() - 1];
+    last.x = dstX;
+    last.y = dstY;
+    last.z = dstZ;
+
+    CachedPath cached;
+    cached.path = path;
+    cached.generation = generation;
+
+    ACE_Guard<ACE_Thread_Mutex> guard(i_cacheLock);
+    uint32 const cacheSize = sWorld.getConfig(CONFIG_UINT32_PATHFINDING_CACHE_SIZE);
+    if (!cacheSize)
+        return true;
+
+    while (i_pathCacheOrder.size() >= cacheSize)
+    {
+        i_pathCache.erase(i_pathCacheOrder.front());
+        i_pathCacheOrder.pop_front();
+    }
+
+    if (i_pathCache.find(cacheKey) == i_pathCache.end())
+        i_pathCacheOrder.push_back(cacheKey);
+    i_pathCache[cacheKey] = cached;
+    return true;
+}
+
+bool MoveMap::GetCachedPath(uint64 key, uint32 generation, SimplePath& path)
+{
+    ACE_Guard<ACE_Thread_Mutex> guard(i_cacheLock);
+
+    PathCache::const_iterator itr = i_pathCache.find(key);
+    if (itr == i_pathCache.end())
+        return false;
+
+    // tiles set changed after path calculation, path can be not valid anymore (removed from cache at overflow)
+    if (itr->second.generation != generation)
+        return false;
+
+    path = itr->second.path;
+    return true;
+}
+
+//-----------------------------------------------//
+bool PathFinder::Calculate(Unit const& owner, float destX, float destY, float destZ)
+{
+    Clear();
+
+    if (!sWorld.getConfig(CONFIG_BOOL_PATHFINDING_ENABLED))
+        return false;
+
+    if (owner.hasUnitState(UNIT_STAT_TAXI_FLIGHT))
+        return false;
+
+    bool canSwim = true;
+    if (owner.GetTypeId() == TYPEID_UNIT)
+    {
+        Creature const& creature = (Creature const&)owner;
+        if (creature.canFly())                              // flyers move in 3D, navigation data is ground only
+            return false;
+
+        canSwim = creature.canSwim();
+    }
+
+    MoveMap* moveMap = owner.GetMap()->GetMoveMap();
+    if (!moveMap)
+        return false;
+
+    if (!moveMap->FindPath(owner.GetPositionX(), owner.GetPositionY(), owner.GetPositionZ(), destX, destY, destZ, canSwim, i_path))
+    {
+        Clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool PathFinder::GetNextPoint(float& x, float& y, float& z)
+{
+    if (!HasNextPoint())
+        return false;
+
+    SimplePathNode const& node = i_path[i_nextNode++];
+    x = node.x;
+    y = node.y;
+    z = node.z;
+    return true;
+}
+
+bool PathFinder::GetEndPoint(float& x, float& y, float& z) const
+{
+    if (!HasNextPoint())
+        return false;
+
+    SimplePathNode const& node = i_path[i_path.size() - 1];
+    x = node.x;
+    y = node.y;
+    z = node.z;
+    return true;
+}
+
+float PathFinder::GetLength(Unit const& owner) const
+{
+    if (!HasNextPoint())
+        return 0.0f;
+
+    SimplePathNode const& first = i_path[i_nextNode];
+    return owner.GetDistance2d(first.x, first.y) + i_path.GetTotalLength(i_nextNode, i_path.size());
+}
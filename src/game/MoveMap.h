@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_MOVEMAP_H
+#define MANGOS_MOVEMAP_H
+
+#include "Common.h"
+#include "MoveMapDefines.h"
+#include "Path.h"
+#include "Utilities/UnorderedMap.h"
+
+#include <ace/Thread_Mutex.h>
+#include <ace/RW_Thread_Mutex.h>
+#include <deque>
+
+class Unit;
+
+class MoveMapTile
+{
+    public:
+        MoveMapTile() : m_cells(NULL) {}
+        ~MoveMapTile() { unloadData(); }
+
+        bool loadData(char const* filename);
+        void unloadData();
+
+        MoveMapCell const* getCell(uint32 lx, uint32 ly) const { return &m_cells[lx * MMAP_CELLS_PER_GRID + ly]; }
+
+    private:
+        MoveMapCell* m_cells;
+};
+
+/**
+ * Navigation data of one base map (shared by all its instances) built by contrib/mmap_generator.
+ * Tiles are loaded/unloaded together with the grid map files, path queries can be done from
+ * any map update thread: tiles are read under shared lock and found paths are cached.
+ */
+class MANGOS_DLL_DECL MoveMap
+{
+    public:
+        explicit MoveMap(uint32 mapId);
+        ~MoveMap();
+
+        void LoadTile(int gx, int gy);
+        void UnloadTile(int gx, int gy);
+
+        // fill path by points (without start position, last is destination), false if no known way
+        bool FindPath(float srcX, float srcY, float srcZ, float dstX, float dstY, float dstZ, bool canSwim, SimplePath& path);
+
+    private:
+        typedef ACE_RW_Thread_Mutex LockType;
+        typedef ACE_Read_Guard<LockType> ReadGuard;
+        typedef ACE_Write_Guard<LockType> WriteGuard;
+
+        struct CachedPath
+        {
+            SimplePath path;
+            uint32 generation;
+        };
+
+        typedef UNORDERED_MAP<uint64, CachedPath> PathCache;
+        typedef std::vector<uint32> CellList;
+
+        // next functions expect i_tilesLock locked (GetCachedPath lock cache itself)
+        MoveMapCell const* GetCell(uint32 cx, uint32 cy) const;
+        bool IsDirectPath(uint32 fromCell, uint32 toCell, bool canSwim) const;
+        bool SearchPath(uint32 srcCell, uint32 dstCell, bool canSwim, CellList& cells) const;
+
+        bool GetCachedPath(uint64 key, uint32 generation, SimplePath& path);
+
+        uint32 i_mapId;
+        MoveMapTile* i_tiles[MMAP_MAX_GRIDS][MMAP_MAX_GRIDS];
+        uint32 i_generation;                                // increased at each tile load/unload, outdates cached paths
+        LockType i_tilesLock;
+
+        PathCache i_pathCache;
+        std::deque<uint64> i_pathCacheOrder;                // insert order for drop oldest paths at cache overflow
+        ACE_Thread_Mutex i_cacheLock;
+};
+
+/**
+ * Path holder for movement generators: calculate way to destination by navigation data and
+ * provide it point by point. If no navigation data available then caller must use straight line.
+ */
+class MANGOS_DLL_DECL PathFinder
+{
+    public:
+        PathFinder() : i_nextNode(0) {}
+
+        bool Calculate(Unit const& owner, float destX, float destY, float destZ);
+        void Clear() { i_path.clear(); i_nextNode = 0; }
+
+        bool HasNextPoint() const { return i_nextNode < i_path.size(); }
+        bool GetNextPoint(float& x, float& y, float& z);
+        bool GetEndPoint(float& x, float& y, float& z) const;
+        float GetLength(Unit const& owner) const;
+
+    private:
+        SimplePath i_path;
+        uint32 i_nextNode;
+};
+
+#endif
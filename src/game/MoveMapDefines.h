@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_MOVEMAPDEFINES_H
+#define MANGOS_MOVEMAPDEFINES_H
+
+// Shared between the server and contrib/mmap_generator, must not depend on game headers
+#include "Platform/Define.h"
+
+#define MMAP_MAGIC              "MMAP"
+#define MMAP_VERSION_MAGIC      "v1.0"
+
+// navigation cell grid uses same resolution as .map height data (MAP_RESOLUTION)
+#define MMAP_CELLS_PER_GRID     128
+#define MMAP_GRID_SIZE          533.33333f                  // must be equal to SIZE_OF_GRIDS
+#define MMAP_CELL_SIZE          (MMAP_GRID_SIZE / MMAP_CELLS_PER_GRID)
+#define MMAP_MAX_GRIDS          64
+#define MMAP_MAX_CELLS          (MMAP_CELLS_PER_GRID * MMAP_MAX_GRIDS)
+
+struct MoveMapFileHeader
+{
+    uint32 mmapMagic;
+    uint32 versionMagic;
+    uint32 buildMagic;
+    uint32 cellsPerGrid;
+};
+
+enum MoveMapCellFlags
+{
+    MMAP_CELL_NO_GROUND     = 0x01,                         // no height data, never walkable
+    MMAP_CELL_WATER         = 0x02,                         // deep liquid above ground, only for swimmers
+    MMAP_CELL_WMO           = 0x04,                         // ground height taken from vmap model floor
+};
+
+// link bits to the 8 neighbour cells, indexes into MoveMapDirOffset tables
+enum MoveMapDirection
+{
+    MMAP_DIR_XP     = 0,
+    MMAP_DIR_XP_YP  = 1,
+    MMAP_DIR_YP     = 2,
+    MMAP_DIR_XN_YP  = 3,
+    MMAP_DIR_XN     = 4,
+    MMAP_DIR_XN_YN  = 5,
+    MMAP_DIR_YN     = 6,
+    MMAP_DIR_XP_YN  = 7,
+    MMAP_DIR_COUNT  = 8
+};
+
+static const int32 MoveMapDirOffsetX[MMAP_DIR_COUNT] = { 1,  1,  0, -1, -1, -1,  0,  1 };
+static const int32 MoveMapDirOffsetY[MMAP_DIR_COUNT] = { 0,  1,  1,  1,  0, -1, -1, -1 };
+
+// cell index space: cx = MMAP_CELLS_PER_GRID * (32 - x/MMAP_GRID_SIZE), same orientation as .map files
+// cells are stored in file as [cellsPerGrid][cellsPerGrid], first index along x
+struct MoveMapCell
+{
+    float height;
+    uint8 flags;                                            // MoveMapCellFlags
+    uint8 links;                                            // bit (1 << MoveMapDirection) set if neighbour reachable
+    uint16 reserved;
+};
+
+#endif
@@ -747,19 +747,12 @@ bool Object::LoadValues(const char* data)
 {
     if(!m_uint32Values) _InitValues();
 
-    Tokens tokens = StrSplit(data, " ");
-
-    if(tokens.size() != m_valuesCount)
-        return false;
-
-    Tokens::iterator iter;
-    int index;
-    for (iter = tokens.begin(), index = 0; index < m_valuesCount; ++iter, ++index)
-    {
-        m_uint32Values[index] = atol((*iter).c_str());
-    }
+    return UInt32ArrayFromString(data, m_uint32Values, m_valuesCount) == m_valuesCount;
+}
 
-    return true;
+std::string Object::GetValuesString() const
+{
+    return UInt32ArrayToString(m_uint32Values, m_valuesCount);
 }
 
 void Object::_SetUpdateBits(UpdateMask *updateMask, Player* /*target*/) const
@@ -281,6 +281,7 @@ class MANGOS_DLL_SPEC Object
         void ClearUpdateMask(bool remove);
 
         bool LoadValues(const char* data);
+        std::string GetValuesString() const;                // values in compact DB form, see UInt32ArrayToString
 
         uint16 GetValuesCount() const { return m_valuesCount; }
 
@@ -277,6 +277,7 @@ void ObjectAccessor::RemoveOldCorpses()
 
 template <class T> UNORDERED_MAP< uint64, T* > HashMapHolder<T>::m_objectMap;
 template <class T> ACE_RW_Thread_Mutex HashMapHolder<T>::i_lock;
+template <class T> typename HashMapHolder<T>::Shard HashMapHolder<T>::m_shards[HASH_MAP_HOLDER_SHARDS];
 
 /// Global definitions for the hashmap storage
 
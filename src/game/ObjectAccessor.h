@@ -42,6 +42,9 @@ class GameObject;
 class WorldObject;
 class Map;
 
+// must be power of 2, guid counters sequential so low bits spread objects evenly
+#define HASH_MAP_HOLDER_SHARDS 16
+
 template <class T>
 class HashMapHolder
 {
@@ -54,21 +57,36 @@ class HashMapHolder
 
         static void Insert(T* o)
         {
-            WriteGuard guard(i_lock);
-            m_objectMap[o->GetGUID()] = o;
+            uint64 guid = o->GetGUID();
+            {
+                WriteGuard guard(i_lock);
+                m_objectMap[guid] = o;
+            }
+
+            Shard& shard = GetShard(guid);
+            WriteGuard guard(shard.lock);
+            shard.objects[guid] = o;
         }
 
         static void Remove(T* o)
         {
-            WriteGuard guard(i_lock);
-            m_objectMap.erase(o->GetGUID());
+            uint64 guid = o->GetGUID();
+            {
+                WriteGuard guard(i_lock);
+                m_objectMap.erase(guid);
+            }
+
+            Shard& shard = GetShard(guid);
+            WriteGuard guard(shard.lock);
+            shard.objects.erase(guid);
         }
 
         static T* Find(ObjectGuid guid)
         {
-            ReadGuard guard(i_lock);
-            typename MapType::iterator itr = m_objectMap.find(guid.GetRawValue());
-            return (itr != m_objectMap.end()) ? itr->second : NULL;
+            Shard& shard = GetShard(guid.GetRawValue());
+            ReadGuard guard(shard.lock);
+            typename MapType::iterator itr = shard.objects.find(guid.GetRawValue());
+            return (itr != shard.objects.end()) ? itr->second : NULL;
         }
 
         static MapType& GetContainer() { return m_objectMap; }
@@ -77,11 +95,22 @@ class HashMapHolder
 
     private:
 
+        // Lookup by guid use only own shard lock and small map, so it not wait for
+        // iteration of full container or for insert/remove of objects from other shards
+        struct Shard
+        {
+            LockType lock;
+            MapType  objects;
+        };
+
+        static Shard& GetShard(uint64 guid) { return m_shards[guid % HASH_MAP_HOLDER_SHARDS]; }
+
         //Non instanceable only static
         HashMapHolder() {}
 
         static LockType i_lock;
-        static MapType  m_objectMap;
+        static MapType  m_objectMap;                        // all objects, for iteration and search by other keys
+        static Shard    m_shards[HASH_MAP_HOLDER_SHARDS];   // same objects split by guid, for lookup by guid
 };
 
 class MANGOS_DLL_DECL ObjectAccessor : public MaNGOS::Singleton<ObjectAccessor, MaNGOS::ClassLevelLockable<ObjectAccessor, ACE_Thread_Mutex> >
@@ -155,7 +155,8 @@ ObjectMgr::ObjectMgr() :
     m_GuildIds("Guild ids"),
     m_MailIds("Mail ids"),
     m_PetNumbers("Pet numbers"),
-    m_GroupIds("Group ids")
+    m_GroupIds("Group ids"),
+    m_oldMailsBaseTime(0), m_oldMailsQueryInProgress(false)
 {
     // Only zero condition left, others will be added while loading DB tables
     mConditions.resize(1);
@@ -4987,16 +4988,33 @@ void ObjectMgr::LoadNpcTextLocales()
     sLog.outString( ">> Loaded %lu NpcText locale strings", (unsigned long)mNpcTextLocaleMap.size() );
 }
 
+// expired mails returned or deleted at one world update
+#define OLD_MAILS_PER_UPDATE 500
+
 //not very fast function but it is called only once a day, or on starting-up
 void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 {
     time_t basetime = time(NULL);
     DEBUG_LOG("Returning mails current time: hour: %d, minute: %d, second: %d ", localtime(&basetime)->tm_hour, localtime(&basetime)->tm_min, localtime(&basetime)->tm_sec);
+
+    // at server work not block world thread, mails processed by parts at world updates after query result receive
+    if (serverUp)
+    {
+        // previous job not finished yet
+        if (m_oldMailsQueryInProgress || !m_oldMails.empty())
+            return;
+
+        m_oldMailsQueryInProgress = true;
+        //                                                                                                   0  1           2      3        4         5
+        CharacterDatabase.AsyncPQuery(this, &ObjectMgr::ReturnOrDeleteOldMailsCallback, (uint64)basetime, "SELECT id,messageType,sender,receiver,has_items,checked FROM mail WHERE expire_time < '" UI64FMTD "'", (uint64)basetime);
+        return;
+    }
+
     //delete all old mails without item and without body immediately, if starting server
-    if (!serverUp)
-        CharacterDatabase.PExecute("DELETE FROM mail WHERE expire_time < '" UI64FMTD "' AND has_items = '0' AND body = ''", (uint64)basetime);
-    //                                                     0  1           2      3        4         5           6   7       8
-    QueryResult* result = CharacterDatabase.PQuery("SELECT id,messageType,sender,receiver,has_items,expire_time,cod,checked,mailTemplateId FROM mail WHERE expire_time < '" UI64FMTD "'", (uint64)basetime);
+    CharacterDatabase.PExecute("DELETE FROM mail WHERE expire_time < '" UI64FMTD "' AND has_items = '0' AND body = ''", (uint64)basetime);
+
+    //                                                     0  1           2      3        4         5
+    QueryResult* result = CharacterDatabase.PQuery("SELECT id,messageType,sender,receiver,has_items,checked FROM mail WHERE expire_time < '" UI64FMTD "'", (uint64)basetime);
     if ( !result )
     {
         barGoLink bar(1);
@@ -5006,86 +5024,117 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
         return;                                             // any mails need to be returned or deleted
     }
 
-    //std::ostringstream delitems, delmails; //will be here for optimization
-    //bool deletemail = false, deleteitem = false;
-    //delitems << "DELETE FROM item_instance WHERE guid IN ( ";
-    //delmails << "DELETE FROM mail WHERE id IN ( "
+    m_oldMailsBaseTime = basetime;
 
     barGoLink bar( (int)result->GetRowCount() );
+    LoadOldMails(result);
+
     uint32 count = 0;
-    Field *fields;
+    while (!m_oldMails.empty())
+    {
+        size_t queued = m_oldMails.size();
+        count += ProcessOldMails(false);
+
+        for (size_t i = m_oldMails.size(); i < queued; ++i)
+            bar.step();
+    }
+
+    sLog.outString();
+    sLog.outString( ">> Loaded %u mails", count );
+}
+
+void ObjectMgr::ReturnOrDeleteOldMailsCallback(QueryResult* result, uint64 basetime)
+{
+    m_oldMailsQueryInProgress = false;
+
+    if (!result)
+        return;
+
+    m_oldMailsBaseTime = time_t(basetime);
+    LoadOldMails(result);
+}
 
+void ObjectMgr::LoadOldMails(QueryResult* result)
+{
     do
     {
-        bar.step();
+        Field *fields = result->Fetch();
 
-        fields = result->Fetch();
-        Mail *m = new Mail;
-        m->messageID = fields[0].GetUInt32();
-        m->messageType = fields[1].GetUInt8();
-        m->sender = fields[2].GetUInt32();
-        m->receiver = fields[3].GetUInt32();
-        bool has_items = fields[4].GetBool();
-        m->expire_time = (time_t)fields[5].GetUInt64();
-        m->deliver_time = 0;
-        m->COD = fields[6].GetUInt32();
-        m->checked = fields[7].GetUInt32();
-        m->mailTemplateId = fields[8].GetInt16();
-
-        Player *pl = 0;
-        if (serverUp)
-            pl = GetPlayer((uint64)m->receiver);
-        if (pl)
-        {                                                   //this code will run very improbably (the time is between 4 and 5 am, in game is online a player, who has old mail
-            //his in mailbox and he has already listed his mails )
-            delete m;
-            continue;
-        }
-        //delete or return mail:
-        if (has_items)
-        {
-            QueryResult *resultItems = CharacterDatabase.PQuery("SELECT item_guid,item_template FROM mail_items WHERE mail_id='%u'", m->messageID);
-            if(resultItems)
-            {
-                do
-                {
-                    Field *fields2 = resultItems->Fetch();
+        OldMail m;
+        m.id = fields[0].GetUInt32();
+        m.messageType = fields[1].GetUInt8();
+        m.sender = fields[2].GetUInt32();
+        m.receiver = fields[3].GetUInt32();
+        m.hasItems = fields[4].GetBool();
+        m.checked = fields[5].GetUInt32();
 
-                    uint32 item_guid_low = fields2[0].GetUInt32();
-                    uint32 item_template = fields2[1].GetUInt32();
+        m_oldMails.push_back(m);
+    } while (result->NextRow());
 
-                    m->AddItem(item_guid_low, item_template);
-                }
-                while (resultItems->NextRow());
+    delete result;
+}
 
-                delete resultItems;
-            }
+void ObjectMgr::UpdateOldMails()
+{
+    if (!m_oldMails.empty())
+        ProcessOldMails(true);
+}
+
+uint32 ObjectMgr::ProcessOldMails(bool serverUp)
+{
+    std::ostringstream delMails;
+    std::ostringstream delItems;                            // mails with items deleted instead returning
+    uint32 count = 0;
+    uint32 itemMailsCount = 0;
+
+    CharacterDatabase.BeginTransaction();
+
+    for (uint32 processed = 0; processed < OLD_MAILS_PER_UPDATE && !m_oldMails.empty(); ++processed)
+    {
+        OldMail m = m_oldMails.front();
+        m_oldMails.pop_front();
+
+        //this code will run very improbably (the time is between 4 and 5 am, in game is online a player, who has old mail
+        //his in mailbox and he has already listed his mails )
+        if (serverUp && GetPlayer((uint64)m.receiver))
+            continue;
+
+        //delete or return mail:
+        if (m.hasItems)
+        {
             //if it is mail from AH, it shouldn't be returned, but deleted
-            if (m->messageType != MAIL_NORMAL || m->messageType == MAIL_AUCTION || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
+            if (m.messageType != MAIL_NORMAL || (m.checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
             {
                 // mail open and then not returned
-                for(std::vector<MailItemInfo>::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                    CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid = '%u'", itr2->item_guid);
+                delItems << (itemMailsCount ? "," : "") << m.id;
+                ++itemMailsCount;
             }
             else
             {
                 //mail will be returned:
-                CharacterDatabase.PExecute("UPDATE mail SET sender = '%u', receiver = '%u', expire_time = '" UI64FMTD "', deliver_time = '" UI64FMTD "',cod = '0', checked = '%u' WHERE id = '%u'", m->receiver, m->sender, (uint64)(basetime + 30*DAY), (uint64)basetime, MAIL_CHECK_MASK_RETURNED, m->messageID);
-                delete m;
+                CharacterDatabase.PExecute("UPDATE mail SET sender = '%u', receiver = '%u', expire_time = '" UI64FMTD "', deliver_time = '" UI64FMTD "',cod = '0', checked = '%u' WHERE id = '%u'",
+                    m.receiver, m.sender, (uint64)(m_oldMailsBaseTime + 30*DAY), (uint64)m_oldMailsBaseTime, MAIL_CHECK_MASK_RETURNED, m.id);
                 continue;
             }
         }
 
-        //deletemail = true;
-        //delmails << m->messageID << ", ";
-        CharacterDatabase.PExecute("DELETE FROM mail WHERE id = '%u'", m->messageID);
-        delete m;
+        delMails << (count ? "," : "") << m.id;
         ++count;
-    } while (result->NextRow());
-    delete result;
+    }
 
-    sLog.outString();
-    sLog.outString( ">> Loaded %u mails", count );
+    // items selected by mail_items at execution, items taken from mail after result receive not affected
+    if (itemMailsCount)
+    {
+        CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid IN (SELECT item_guid FROM mail_items WHERE mail_id IN (%s))", delItems.str().c_str());
+        CharacterDatabase.PExecute("DELETE FROM mail_items WHERE mail_id IN (%s)", delItems.str().c_str());
+    }
+
+    if (count)
+        CharacterDatabase.PExecute("DELETE FROM mail WHERE id IN (%s)", delMails.str().c_str());
+
+    CharacterDatabase.CommitTransaction();
+
+    return count;
 }
 
 void ObjectMgr::LoadQuestAreaTriggers()
@@ -7669,6 +7718,8 @@ void ObjectMgr::LoadFishingBaseSkillLevel()
 uint16 ObjectMgr::GetConditionId( ConditionType condition, uint32 value1, uint32 value2 )
 {
     PlayerCondition lc = PlayerCondition(condition, value1, value2);
+
+    ACE_Guard<ACE_Thread_Mutex> guard(mConditionsLock);
     for (uint16 i=0; i < mConditions.size(); ++i)
     {
         if (lc == mConditions[i])
@@ -760,6 +760,8 @@ class ObjectMgr
         }
 
         void ReturnOrDeleteOldMails(bool serverUp);
+        void ReturnOrDeleteOldMailsCallback(QueryResult* result, uint64 basetime);
+        void UpdateOldMails();
 
         void SetHighestGuids();
         uint32 GenerateLowGuid(HighGuid guidhigh);
@@ -1086,6 +1088,21 @@ class ObjectMgr
         int DBCLocaleIndex;
 
     private:
+        struct OldMail
+        {
+            uint32 id;
+            uint32 sender;
+            uint32 receiver;
+            uint8 messageType;
+            uint32 checked;
+            bool hasItems;
+        };
+
+        typedef std::deque<OldMail> OldMailQueue;
+
+        void LoadOldMails(QueryResult* result);
+        uint32 ProcessOldMails(bool serverUp);
+
         void LoadScripts(ScriptMapMap& scripts, char const* tablename);
         void CheckScriptTexts(ScriptMapMap const& scripts,std::set<int32>& ids);
         void LoadCreatureAddons(SQLStorage& creatureaddons, char const* entryName, char const* comment);
@@ -1094,6 +1111,10 @@ class ObjectMgr
 
         MailLevelRewardMap m_mailLevelRewardMap;
 
+        OldMailQueue m_oldMails;                            // expired mails, returned or deleted by parts at world updates
+        time_t m_oldMailsBaseTime;
+        bool m_oldMailsQueryInProgress;
+
         typedef std::map<uint32,PetLevelInfo*> PetLevelInfoMap;
         // PetLevelInfoMap[creature_id][level]
         PetLevelInfoMap petInfo;                            // [creature_id][level]
@@ -1134,6 +1155,7 @@ class ObjectMgr
         // Storage for Conditions. First element (index 0) is reserved for zero-condition (nothing required)
         typedef std::vector<PlayerCondition> ConditionStore;
         ConditionStore mConditions;
+        ACE_Thread_Mutex mConditionsLock;                   // GetConditionId called by loot and gossip loading steps in parallel
 
         CacheNpcTextIdMap m_mCacheNpcTextIdMap;
         CacheVendorItemMap m_mCacheVendorItemMap;
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "PacketCapture.h"
+#include "ByteBuffer.h"
+#include "Opcodes.h"
+#include "Timer.h"
+#include "Policies/SingletonImp.h"
+
+INSTANTIATE_SINGLETON_1( PacketCapture );
+
+// not written data limit, packets dropped if writer not keep up
+#define PACKET_CAPTURE_MAX_PENDING  (64*1024*1024)
+// capture writer thread sleep between writes
+#define PACKET_CAPTURE_WRITER_SLEEP 10
+
+class PacketCaptureWriter : public ACE_Based::Runnable
+{
+    public:
+        explicit PacketCaptureWriter(PacketCapture* capture) : m_capture(capture), m_running(true) {}
+
+        void Stop() { m_running = false; }
+
+        void run()
+        {
+            while (m_running)
+            {
+                ACE_Based::Thread::Sleep(PACKET_CAPTURE_WRITER_SLEEP);
+                m_capture->WritePending();
+            }
+
+            // data captured before stop
+            m_capture->WritePending();
+        }
+
+    private:
+        PacketCapture* m_capture;
+        volatile bool m_running;
+};
+
+template<typename T>
+static void appendValue(std::vector<uint8>& buf, T value)
+{
+    EndianConvert(value);
+    uint8 const* ptr = (uint8 const*)&value;
+    buf.insert(buf.end(), ptr, ptr + sizeof(T));
+}
+
+PacketCapture::PacketCapture() : m_active(false), m_file(NULL), m_startTime(0), m_writer(NULL), m_writerThread(NULL)
+{
+}
+
+PacketCapture::~PacketCapture()
+{
+    Stop();
+}
+
+bool PacketCapture::Start(std::string const& filename)
+{
+    if (m_writerThread)
+        return false;
+
+    FILE* file = fopen(filename.c_str(), "wb");
+    if (!file)
+        return false;
+
+    std::vector<uint8> header;
+    appendValue<uint32>(header, PACKET_CAPTURE_MAGIC);
+    appendValue<uint16>(header, PACKET_CAPTURE_VERSION);
+    appendValue<uint16>(header, 0);
+    appendValue<uint64>(header, uint64(time(NULL)));
+    fwrite(&header[0], 1, header.size(), file);
+
+    {
+        Guard guard(m_lock);
+        m_file = file;
+        m_filename = filename;
+        m_startTime = getMSTime();
+        m_pending.clear();
+        m_namedOpcodes.assign(NUM_MSG_TYPES, false);
+        m_stats = PacketCaptureStats();
+        m_stats.bytesWritten = header.size();
+    }
+
+    m_writer = new PacketCaptureWriter(this);               // will deleted at m_writerThread delete
+    m_writerThread = new ACE_Based::Thread(m_writer);
+
+    m_active = true;
+    return true;
+}
+
+void PacketCapture::Stop()
+{
+    if (!m_writerThread)
+        return;
+
+    m_active = false;
+    m_writer->Stop();
+    m_writerThread->wait();                                 // write all captured data
+    delete m_writerThread;                                  // this also deletes m_writer
+    m_writerThread = NULL;
+    m_writer = NULL;
+
+    Guard guard(m_lock);
+    fclose(m_file);
+    m_file = NULL;
+    m_pending.clear();
+}
+
+std::string PacketCapture::GetFilename() const
+{
+    Guard guard(m_lock);
+    return m_filename;
+}
+
+void PacketCapture::DoCapture(uint32 socket, uint32 account, ByteBuffer const& packet, uint16 opcode, PacketCaptureDirection direction)
+{
+    Guard guard(m_lock);
+
+    if (!m_file)
+        return;
+
+    if (!m_opcodeFilter.empty() && m_opcodeFilter.find(opcode) == m_opcodeFilter.end())
+        return;
+
+    if (!m_accountFilter.empty() && m_accountFilter.find(account) == m_accountFilter.end())
+        return;
+
+    if (m_pending.size() + packet.size() > PACKET_CAPTURE_MAX_PENDING)
+    {
+        ++m_stats.dropped;
+        return;
+    }
+
+    // decoder not need opcode table of this server version
+    if (opcode < m_namedOpcodes.size() && !m_namedOpcodes[opcode])
+    {
+        std::string name = LookupOpcodeName(opcode);
+        if (name.size() > 255)
+            name.resize(255);
+
+        appendValue<uint8>(m_pending, PACKET_CAPTURE_RECORD_OPCODE_NAME);
+        appendValue<uint16>(m_pending, opcode);
+        appendValue<uint8>(m_pending, uint8(name.size()));
+        m_pending.insert(m_pending.end(), name.begin(), name.end());
+
+        m_namedOpcodes[opcode] = true;
+    }
+
+    appendValue<uint8>(m_pending, PACKET_CAPTURE_RECORD_PACKET);
+    appendValue<uint32>(m_pending, getMSTimeDiff(m_startTime, getMSTime()));
+    appendValue<uint32>(m_pending, socket);
+    appendValue<uint32>(m_pending, account);
+    appendValue<uint8>(m_pending, uint8(direction));
+    appendValue<uint16>(m_pending, opcode);
+    appendValue<uint32>(m_pending, uint32(packet.size()));
+    if (packet.size())
+        m_pending.insert(m_pending.end(), packet.contents(), packet.contents() + packet.size());
+
+    ++m_stats.packets;
+}
+
+void PacketCapture::WritePending()
+{
+    FILE* file;
+    {
+        Guard guard(m_lock);
+        m_writeBuffer.swap(m_pending);
+        file = m_file;
+    }
+
+    if (m_writeBuffer.empty())
+        return;
+
+    size_t written = fwrite(&m_writeBuffer[0], 1, m_writeBuffer.size(), file);
+    fflush(file);
+
+    // keep capacity for next swap
+    m_writeBuffer.clear();
+
+    Guard guard(m_lock);
+    m_stats.bytesWritten += written;
+}
+
+bool PacketCapture::ToggleFilter(FilterSet& filter, uint32 value)
+{
+    Guard guard(m_lock);
+
+    if (filter.erase(value))
+        return false;
+
+    filter.insert(value);
+    return true;
+}
+
+void PacketCapture::ClearOpcodeFilter()
+{
+    Guard guard(m_lock);
+    m_opcodeFilter.clear();
+}
+
+void PacketCapture::ClearAccountFilter()
+{
+    Guard guard(m_lock);
+    m_accountFilter.clear();
+}
+
+PacketCapture::FilterSet PacketCapture::GetOpcodeFilter() const
+{
+    Guard guard(m_lock);
+    return m_opcodeFilter;
+}
+
+PacketCapture::FilterSet PacketCapture::GetAccountFilter() const
+{
+    Guard guard(m_lock);
+    return m_accountFilter;
+}
+
+PacketCaptureStats PacketCapture::GetStats() const
+{
+    Guard guard(m_lock);
+    PacketCaptureStats stats = m_stats;
+    stats.pendingBytes = m_pending.size();
+    return stats;
+}
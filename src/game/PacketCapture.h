@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _PACKET_CAPTURE_H
+#define _PACKET_CAPTURE_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+
+class ByteBuffer;
+class PacketCaptureWriter;
+
+/*
+ * Capture file format, all values little-endian:
+ *
+ * header:  uint32 magic (PACKET_CAPTURE_MAGIC), uint16 version, uint16 reserved, uint64 capture start unix time
+ * records: uint8 type, then
+ *   PACKET_CAPTURE_RECORD_OPCODE_NAME: uint16 opcode, uint8 name length, name (without 0)
+ *                                      written before first packet with this opcode
+ *   PACKET_CAPTURE_RECORD_PACKET:      uint32 ms from capture start, uint32 socket, uint32 account (0 before auth),
+ *                                      uint8 direction (PacketCaptureDirection), uint16 opcode, uint32 size, packet data
+ *
+ * contrib/packet_decoder print capture files as text.
+ */
+
+#define PACKET_CAPTURE_MAGIC    0x544B504D                  // "MPKT"
+#define PACKET_CAPTURE_VERSION  1
+
+enum PacketCaptureRecordType
+{
+    PACKET_CAPTURE_RECORD_OPCODE_NAME = 1,
+    PACKET_CAPTURE_RECORD_PACKET      = 2,
+};
+
+enum PacketCaptureDirection
+{
+    PACKET_CAPTURE_CLIENT   = 0,                            // client to server
+    PACKET_CAPTURE_SERVER   = 1,                            // server to client
+};
+
+struct PacketCaptureStats
+{
+    PacketCaptureStats() : packets(0), dropped(0), bytesWritten(0), pendingBytes(0) {}
+
+    uint64 packets;
+    uint64 dropped;                                         // at full pending buffer
+    uint64 bytesWritten;
+    uint32 pendingBytes;
+};
+
+/**
+ * Binary capture of world packets. Network and world threads only append records to memory buffer,
+ * file written by capture writer thread. Capture can be limited to selected opcodes and accounts.
+ * All public functions are thread safe.
+ */
+class PacketCapture
+{
+    public:
+        typedef std::set<uint32> FilterSet;
+
+        PacketCapture();
+        ~PacketCapture();
+
+        bool Start(std::string const& filename);
+        void Stop();
+        bool IsActive() const { return m_active; }
+        std::string GetFilename() const;
+
+        void Capture(uint32 socket, uint32 account, ByteBuffer const& packet, uint16 opcode, PacketCaptureDirection direction)
+        {
+            if (m_active)
+                DoCapture(socket, account, packet, opcode, direction);
+        }
+
+        // empty filter set - capture all, return new filter state for value
+        bool ToggleOpcodeFilter(uint32 opcode) { return ToggleFilter(m_opcodeFilter, opcode); }
+        bool ToggleAccountFilter(uint32 account) { return ToggleFilter(m_accountFilter, account); }
+        void ClearOpcodeFilter();
+        void ClearAccountFilter();
+        FilterSet GetOpcodeFilter() const;
+        FilterSet GetAccountFilter() const;
+
+        PacketCaptureStats GetStats() const;
+
+        void WritePending();                                // called from capture writer thread
+
+    private:
+        void DoCapture(uint32 socket, uint32 account, ByteBuffer const& packet, uint16 opcode, PacketCaptureDirection direction);
+        bool ToggleFilter(FilterSet& filter, uint32 value);
+
+        typedef ACE_Thread_Mutex LockType;
+        typedef ACE_Guard<LockType> Guard;
+
+        mutable LockType m_lock;                            // guard all members except writer thread only
+        volatile bool m_active;
+        std::string m_filename;
+        FILE* m_file;
+        uint32 m_startTime;                                 // ms time of capture start
+        std::vector<uint8> m_pending;
+        std::vector<bool> m_namedOpcodes;                   // opcode name record already written
+        FilterSet m_opcodeFilter;
+        FilterSet m_accountFilter;
+        PacketCaptureStats m_stats;
+
+        std::vector<uint8> m_writeBuffer;                   // writer thread only
+
+        PacketCaptureWriter* m_writer;                      // owned by m_writerThread
+        ACE_Based::Thread* m_writerThread;
+};
+
+#define sPacketCapture MaNGOS::Singleton<PacketCapture>::Instance()
+
+#endif
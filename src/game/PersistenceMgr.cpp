@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "PersistenceMgr.h"
+#include "Database/DatabaseEnv.h"
+#include "Policies/SingletonImp.h"
+
+INSTANTIATE_SINGLETON_1( PersistenceMgr );
+
+// rows updated by one statement, limit statement size
+#define PERSISTENCE_ROWS_PER_STATEMENT 100
+
+struct PersistenceTableInfo
+{
+    char const* name;
+    char const* key;
+    char const* columns[MAX_PERSISTENCE_COLUMNS];
+};
+
+static PersistenceTableInfo const persistenceTables[MAX_PERSISTENCE_TABLES] =
+{
+    { "item_instance", "guid", { "data", "owner_guid", "text" } },
+};
+
+PersistenceMgr::PersistenceMgr() : m_pendingCount(0), m_batching(false)
+{
+}
+
+void PersistenceMgr::BeginBatch()
+{
+    ASSERT(!m_batching && !m_pendingCount);
+    m_batching = true;
+}
+
+uint32 PersistenceMgr::WriteBatch()
+{
+    ASSERT(m_batching);
+    m_batching = false;
+
+    if (!m_pendingCount)
+        return 0;
+
+    // caller transaction still open, rows committed together with caller rows
+    for (uint32 i = 0; i < MAX_PERSISTENCE_TABLES; ++i)
+        WriteTable(PersistenceTable(i));
+
+    uint32 rows = m_pendingCount;
+    m_stats.rowsWritten += rows;
+    ++m_stats.batches;
+    m_pendingCount = 0;
+    return rows;
+}
+
+void PersistenceMgr::SetUInt32(PersistenceTable table, uint32 key, uint32 column, uint32 value)
+{
+    char buf[12];
+    snprintf(buf, 12, "%u", value);
+    SetValue(table, key, column, buf);
+}
+
+void PersistenceMgr::SetString(PersistenceTable table, uint32 key, uint32 column, std::string const& value)
+{
+    std::string literal = value;
+    CharacterDatabase.escape_string(literal);
+    SetValue(table, key, column, "'" + literal + "'");
+}
+
+void PersistenceMgr::SetValue(PersistenceTable table, uint32 key, uint32 column, std::string const& literal)
+{
+    ASSERT(m_batching && table < MAX_PERSISTENCE_TABLES && column < MAX_PERSISTENCE_COLUMNS);
+
+    ++m_stats.fieldWrites;
+
+    PendingRows::iterator itr = m_pending[table].find(key);
+    if (itr == m_pending[table].end())
+    {
+        itr = m_pending[table].insert(PendingRows::value_type(key, PendingRow())).first;
+        ++m_pendingCount;
+    }
+    else if (itr->second.mask & (1 << column))
+        ++m_stats.coalescedWrites;                          // replace not written value
+
+    itr->second.values[column] = literal;
+    itr->second.mask |= 1 << column;
+}
+
+void PersistenceMgr::Discard(PersistenceTable table, uint32 key)
+{
+    ASSERT(table < MAX_PERSISTENCE_TABLES);
+
+    if (m_pending[table].erase(key))
+        --m_pendingCount;
+}
+
+void PersistenceMgr::WriteTable(PersistenceTable table)
+{
+    PendingRows& rows = m_pending[table];
+    if (rows.empty())
+        return;
+
+    PersistenceTableInfo const& info = persistenceTables[table];
+
+    // rows with same changed columns set can be updated by one statement
+    typedef std::map<uint32, std::vector<PendingRows::const_iterator> > RowGroups;
+    RowGroups groups;
+    for (PendingRows::const_iterator itr = rows.begin(); itr != rows.end(); ++itr)
+        groups[itr->second.mask].push_back(itr);
+
+    for (RowGroups::const_iterator group = groups.begin(); group != groups.end(); ++group)
+    {
+        std::vector<PendingRows::const_iterator> const& groupRows = group->second;
+        for (size_t start = 0; start < groupRows.size(); start += PERSISTENCE_ROWS_PER_STATEMENT)
+        {
+            size_t end = std::min(start + PERSISTENCE_ROWS_PER_STATEMENT, groupRows.size());
+
+            std::ostringstream ss;
+            ss << "UPDATE " << info.name << " SET ";
+
+            bool firstColumn = true;
+            for (uint32 column = 0; column < MAX_PERSISTENCE_COLUMNS; ++column)
+            {
+                if (!(group->first & (1 << column)))
+                    continue;
+
+                if (!firstColumn)
+                    ss << ", ";
+                firstColumn = false;
+
+                ss << info.columns[column] << " = ";
+                if (end - start == 1)
+                    ss << groupRows[start]->second.values[column];
+                else
+                {
+                    ss << "CASE " << info.key;
+                    for (size_t i = start; i < end; ++i)
+                        ss << " WHEN " << groupRows[i]->first << " THEN " << groupRows[i]->second.values[column];
+                    ss << " END";
+                }
+            }
+
+            if (end - start == 1)
+                ss << " WHERE " << info.key << " = " << groupRows[start]->first;
+            else
+            {
+                ss << " WHERE " << info.key << " IN (";
+                for (size_t i = start; i < end; ++i)
+                    ss << (i == start ? "" : ",") << groupRows[i]->first;
+                ss << ")";
+            }
+
+            CharacterDatabase.Execute(ss.str().c_str());
+            ++m_stats.statements;
+        }
+    }
+
+    rows.clear();
+}
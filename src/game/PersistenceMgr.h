@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _PERSISTENCE_MGR_H
+#define _PERSISTENCE_MGR_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+
+enum PersistenceTable
+{
+    PERSISTENCE_ITEM_INSTANCE       = 0,
+};
+
+#define MAX_PERSISTENCE_TABLES        1
+
+enum ItemInstanceColumn
+{
+    ITEM_INSTANCE_DATA              = 0,
+    ITEM_INSTANCE_OWNER_GUID        = 1,
+    ITEM_INSTANCE_TEXT              = 2,
+};
+
+#define MAX_PERSISTENCE_COLUMNS       3
+
+struct PersistenceStats
+{
+    PersistenceStats() : fieldWrites(0), coalescedWrites(0), rowsWritten(0), statements(0), batches(0) {}
+
+    uint64 fieldWrites;                                     // all accepted field changes
+    uint64 coalescedWrites;                                 // changes merged into already pending rows
+    uint64 rowsWritten;
+    uint64 statements;
+    uint32 batches;
+};
+
+/**
+ * Batched writes for character DB rows changed often during play. While batch open (player save transaction)
+ * changes accumulated per row in memory, repeated changes of same row replace pending values and at batch end
+ * all pending rows written by multi-row statements into still open caller transaction. So rows always written
+ * together with rows referencing them, nothing left pending after transaction commit. Out of batch callers must
+ * use direct statements. Rows written by direct statements in batch must be discarded from pending.
+ */
+class PersistenceMgr
+{
+    public:
+        PersistenceMgr();
+        ~PersistenceMgr() {}
+
+        void BeginBatch();
+        bool IsBatching() const { return m_batching; }
+        uint32 WriteBatch();                                // must be called before caller transaction commit, return written rows
+
+        void SetUInt32(PersistenceTable table, uint32 key, uint32 column, uint32 value);
+        void SetString(PersistenceTable table, uint32 key, uint32 column, std::string const& value);
+        void Discard(PersistenceTable table, uint32 key);
+
+        PersistenceStats GetStats() const { return m_stats; }
+
+    private:
+        struct PendingRow
+        {
+            PendingRow() : mask(0) {}
+
+            std::string values[MAX_PERSISTENCE_COLUMNS];    // SQL literals
+            uint32 mask;                                    // changed columns
+        };
+
+        typedef std::map<uint32, PendingRow> PendingRows;
+
+        void SetValue(PersistenceTable table, uint32 key, uint32 column, std::string const& literal);
+        void WriteTable(PersistenceTable table);
+
+        PendingRows m_pending[MAX_PERSISTENCE_TABLES];
+        uint32 m_pendingCount;
+        bool m_batching;
+
+        PersistenceStats m_stats;
+};
+
+#define sPersistenceMgr MaNGOS::Singleton<PersistenceMgr>::Instance()
+
+#endif
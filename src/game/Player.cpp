@@ -61,6 +61,8 @@
 #include "SocialMgr.h"
 #include "AchievementMgr.h"
 #include "Mail.h"
+#include "PlayerSaveScheduler.h"
+#include "PersistenceMgr.h"
 
 #include <cmath>
 
@@ -404,6 +406,9 @@ void TradeData::SetAccepted(bool state, bool crosssend /*= false*/)
 //== Player ====================================================
 
 UpdateMask Player::updateVisualBits;
+uint32 Player::m_totalSaves = 0;
+uint64 Player::m_totalSaveStatements = 0;
+uint64 Player::m_totalSaveRows = 0;
 
 Player::Player (WorldSession *session): Unit(), m_achievementMgr(this), m_reputationMgr(this), m_mover(this), m_camera(this)
 {
@@ -454,6 +459,10 @@ Player::Player (WorldSession *session): Unit(), m_achievementMgr(this), m_reputa
     // this must help in case next save after mass player load after server startup
     m_nextSave = urand(m_nextSave/2,m_nextSave*3/2);
 
+    m_savedSections = 0;
+    m_saveStatements = 0;
+    m_saveRows = 0;
+
     clearResurrectRequestData();
 
     m_SpellModRemoveCount = 0;
@@ -1410,9 +1419,9 @@ void Player::Update( uint32 p_time )
     {
         if(p_time >= m_nextSave)
         {
-            // m_nextSave reseted in SaveToDB call
-            SaveToDB();
-            DETAIL_LOG("Player '%s' (GUID: %u) saved", GetName(), GetGUIDLow());
+            // autosave wait turn in save scheduler, timer also reseted in SaveToDB call
+            m_nextSave = sWorld.getConfig(CONFIG_UINT32_INTERVAL_SAVE);
+            sPlayerSaveScheduler.AddPlayer(this);
         }
         else
             m_nextSave -= p_time;
@@ -1627,11 +1636,15 @@ bool Player::BuildEnumData( QueryResult * result, WorldPacket * p_data )
     }
 
 
-    Tokens data = StrSplit(fields[19].GetCppString(), " ");
+    // missing values as zero
+    uint32 equipmentCache[EQUIPMENT_SLOT_END * 2];
+    memset(equipmentCache, 0, sizeof(equipmentCache));
+    UInt32ArrayFromString(fields[19].GetString(), equipmentCache, EQUIPMENT_SLOT_END * 2);
+
     for (uint8 slot = 0; slot < EQUIPMENT_SLOT_END; slot++)
     {
         uint32 visualbase = slot * 2;
-        uint32 item_id = GetUInt32ValueFromArray(data, visualbase);
+        uint32 item_id = equipmentCache[visualbase];
         const ItemPrototype * proto = ObjectMgr::GetItemPrototype(item_id);
         if(!proto)
         {
@@ -1643,7 +1656,7 @@ bool Player::BuildEnumData( QueryResult * result, WorldPacket * p_data )
 
         SpellItemEnchantmentEntry const *enchant = NULL;
 
-        uint32 enchants = GetUInt32ValueFromArray(data, visualbase + 1);
+        uint32 enchants = equipmentCache[visualbase + 1];
         for(uint8 enchantSlot = PERM_ENCHANTMENT_SLOT; enchantSlot <= TEMP_ENCHANTMENT_SLOT; ++enchantSlot)
         {
             // values stored in 2 uint16
@@ -3699,40 +3712,93 @@ void Player::_LoadSpellCooldowns(QueryResult *result)
 
 void Player::_SaveSpellCooldowns()
 {
-    CharacterDatabase.PExecute("DELETE FROM character_spell_cooldown WHERE guid = '%u'", GetGUIDLow());
-
     time_t curTime = time(NULL);
     time_t infTime = curTime + infinityCooldownDelayCheck;
 
-    /* copied following sql-code partly from achievementmgr */
-    bool first_round = true;
-    std::ostringstream ss;
-
-    // remove outdated and save active
+    // remove outdated and collect active
+    SpellCooldowns cooldowns;
     for(SpellCooldowns::iterator itr = m_spellCooldowns.begin();itr != m_spellCooldowns.end();)
     {
         if(itr->second.end <= curTime)
             m_spellCooldowns.erase(itr++);
         else if(itr->second.end <= infTime)                 // not save locked cooldowns, it will be reset or set at reload
         {
+            cooldowns.insert(*itr);
+            ++itr;
+        }
+        else
+            ++itr;
+    }
+
+    bool synced = m_savedSections & PLAYER_SAVED_COOLDOWNS;
+    if (!synced)
+        PExecuteSave("DELETE FROM character_spell_cooldown WHERE guid = '%u'", GetGUIDLow());
+    else
+    {
+        // expired or reset since last save
+        bool first_round = true;
+        uint32 rows = 0;
+        std::ostringstream ss;
+        for(SpellCooldowns::const_iterator itr = m_savedCooldowns.begin(); itr != m_savedCooldowns.end(); ++itr)
+        {
+            if (cooldowns.find(itr->first) != cooldowns.end())
+                continue;
+
             if (first_round)
             {
-                ss << "INSERT INTO character_spell_cooldown (guid,spell,item,time) VALUES ";
+                ss << "DELETE FROM character_spell_cooldown WHERE guid = '" << GetGUIDLow() << "' AND spell IN (";
                 first_round = false;
             }
-            // next new/changed record prefix
             else
                 ss << ", ";
-            ss << "(" << GetGUIDLow() << "," << itr->first << "," << itr->second.itemid << "," << uint64(itr->second.end) << ")";
-            ++itr;
+            ss << itr->first;
+            ++rows;
         }
-        else
-            ++itr;
 
+        if (!first_round)
+        {
+            ss << ")";
+            ExecuteSave(ss.str(), rows);
+        }
+    }
+
+    /* copied following sql-code partly from achievementmgr */
+    bool first_round = true;
+    uint32 rows = 0;
+    std::ostringstream ss;
+
+    for(SpellCooldowns::const_iterator itr = cooldowns.begin(); itr != cooldowns.end(); ++itr)
+    {
+        if (synced)
+        {
+            SpellCooldowns::const_iterator saved = m_savedCooldowns.find(itr->first);
+            if (saved != m_savedCooldowns.end())
+            {
+                if (saved->second.end != itr->second.end || saved->second.itemid != itr->second.itemid)
+                    PExecuteSave("UPDATE character_spell_cooldown SET item = '%u', time = '" UI64FMTD "' WHERE guid = '%u' AND spell = '%u'",
+                        uint32(itr->second.itemid), uint64(itr->second.end), GetGUIDLow(), itr->first);
+                continue;
+            }
+        }
+
+        if (first_round)
+        {
+            ss << "INSERT INTO character_spell_cooldown (guid,spell,item,time) VALUES ";
+            first_round = false;
+        }
+        // next new/changed record prefix
+        else
+            ss << ", ";
+        ss << "(" << GetGUIDLow() << "," << itr->first << "," << itr->second.itemid << "," << uint64(itr->second.end) << ")";
+        ++rows;
     }
+
     // if something changed execute
     if (!first_round)
-        CharacterDatabase.Execute( ss.str().c_str() );
+        ExecuteSave(ss.str(), rows);
+
+    m_savedCooldowns.swap(cooldowns);
+    m_savedSections |= PLAYER_SAVED_COOLDOWNS;
 }
 
 uint32 Player::resetTalentsCost() const
@@ -14983,17 +15049,12 @@ void Player::_LoadIntoDataField(const char* data, uint32 startOffset, uint32 cou
     if(!data)
         return;
 
-    Tokens tokens = StrSplit(data, " ");
-
-    if(tokens.size() != count)
+    // keep default values at broken data
+    std::vector<uint32> values(count);
+    if(UInt32ArrayFromString(data, &values[0], count) != count)
         return;
 
-    Tokens::iterator iter;
-    uint32 index;
-    for (iter = tokens.begin(), index = 0; index < count; ++iter, ++index)
-    {
-        m_uint32Values[startOffset + index] = atol((*iter).c_str());
-    }
+    memcpy(&m_uint32Values[startOffset], &values[0], count * sizeof(uint32));
 }
 
 bool Player::LoadFromDB( uint32 guid, SqlQueryHolder *holder )
@@ -15601,6 +15662,8 @@ bool Player::LoadFromDB( uint32 guid, SqlQueryHolder *holder )
 
     _LoadEquipmentSets(holder->GetResult(PLAYER_LOGIN_QUERY_LOADEQUIPMENTSETS));
 
+    m_savedSections |= PLAYER_SAVED_CHARACTER;
+
     return true;
 }
 
@@ -16700,6 +16763,80 @@ bool Player::_LoadHomeBind(QueryResult *result)
 /***                   SAVE SYSTEM                     ***/
 /*********************************************************/
 
+// Column values of `characters` row, used for insert at first save and update at next saves
+class CharacterRowBuilder
+{
+    public:
+        template<class T>
+        void Add(char const* column, T const& value)
+        {
+            std::ostringstream ss;
+            ss << value;
+            m_columns.push_back(column);
+            m_values.push_back(ss.str());
+        }
+
+        // value must be escaped already
+        void AddString(char const* column, std::string const& value)
+        {
+            m_columns.push_back(column);
+            m_values.push_back("'" + value + "'");
+        }
+
+        std::string GetInsertStatement(char const* table) const
+        {
+            std::ostringstream ss;
+            ss << "INSERT INTO " << table << " (";
+            for(size_t i = 0; i < m_columns.size(); ++i)
+                ss << (i ? ", " : "") << m_columns[i];
+            ss << ") VALUES (";
+            for(size_t i = 0; i < m_values.size(); ++i)
+                ss << (i ? ", " : "") << m_values[i];
+            ss << ")";
+            return ss.str();
+        }
+
+        std::string GetUpdateStatement(char const* table, char const* keyColumn, uint32 key) const
+        {
+            std::ostringstream ss;
+            ss << "UPDATE " << table << " SET ";
+            for(size_t i = 0; i < m_columns.size(); ++i)
+                ss << (i ? ", " : "") << m_columns[i] << " = " << m_values[i];
+            ss << " WHERE " << keyColumn << " = '" << key << "'";
+            return ss.str();
+        }
+
+    private:
+        std::vector<char const*> m_columns;
+        std::vector<std::string> m_values;
+};
+
+void Player::ExecuteSave(std::string const& sql, uint32 rows /*= 1*/)
+{
+    ++m_saveStatements;
+    m_saveRows += rows;
+    CharacterDatabase.Execute(sql.c_str());
+}
+
+void Player::PExecuteSave(const char* format, ...)
+{
+    va_list ap;
+    char szQuery [MAX_QUERY_LEN];
+    va_start(ap, format);
+    int res = vsnprintf( szQuery, MAX_QUERY_LEN, format, ap );
+    va_end(ap);
+
+    if(res==-1)
+    {
+        sLog.outError("SQL Query truncated (and not execute) for format: %s",format);
+        return;
+    }
+
+    ++m_saveStatements;
+    ++m_saveRows;
+    CharacterDatabase.Execute(szQuery);
+}
+
 void Player::SaveToDB()
 {
     // we should assure this: ASSERT((m_nextSave != sWorld.getConfig(CONFIG_UINT32_INTERVAL_SAVE)));
@@ -16719,146 +16856,111 @@ void Player::SaveToDB()
     DEBUG_FILTER_LOG(LOG_FILTER_PLAYER_STATS, "The value of player %s at save: ", m_name.c_str());
     outDebugStatsValues();
 
-    CharacterDatabase.BeginTransaction();
+    m_saveStatements = 0;
+    m_saveRows = 0;
 
-    CharacterDatabase.PExecute("DELETE FROM characters WHERE guid = '%u'",GetGUIDLow());
+    CharacterDatabase.BeginTransaction();
+    sPersistenceMgr.BeginBatch();                           // changed item rows written by multi-row statements
 
     std::string sql_name = m_name;
     CharacterDatabase.escape_string(sql_name);
 
-    std::ostringstream ss;
-    ss << "INSERT INTO characters (guid,account,name,race,class,gender,level,xp,money,playerBytes,playerBytes2,playerFlags,"
-        "map, dungeon_difficulty, position_x, position_y, position_z, orientation, "
-        "taximask, online, cinematic, "
-        "totaltime, leveltime, rest_bonus, logout_time, is_logout_resting, resettalents_cost, resettalents_time, "
-        "trans_x, trans_y, trans_z, trans_o, transguid, extra_flags, stable_slots, at_login, zone, "
-        "death_expire_time, taxi_path, arenaPoints, totalHonorPoints, todayHonorPoints, yesterdayHonorPoints, totalKills, "
-        "todayKills, yesterdayKills, chosenTitle, knownCurrencies, watchedFaction, drunk, health, power1, power2, power3, "
-        "power4, power5, power6, power7, specCount, activeSpec, exploredZones, equipmentCache, ammoId, knownTitles, actionBars) VALUES ("
-        << GetGUIDLow() << ", "
-        << GetSession()->GetAccountId() << ", '"
-        << sql_name << "', "
-        << (uint32)getRace() << ", "
-        << (uint32)getClass() << ", "
-        << (uint32)getGender() << ", "
-        << getLevel() << ", "
-        << GetUInt32Value(PLAYER_XP) << ", "
-        << GetMoney() << ", "
-        << GetUInt32Value(PLAYER_BYTES) << ", "
-        << GetUInt32Value(PLAYER_BYTES_2) << ", "
-        << GetUInt32Value(PLAYER_FLAGS) << ", ";
+    CharacterRowBuilder row;
+    row.Add("guid", GetGUIDLow());
+    row.Add("account", GetSession()->GetAccountId());
+    row.AddString("name", sql_name);
+    row.Add("race", (uint32)getRace());
+    row.Add("class", (uint32)getClass());
+    row.Add("gender", (uint32)getGender());
+    row.Add("level", getLevel());
+    row.Add("xp", GetUInt32Value(PLAYER_XP));
+    row.Add("money", GetMoney());
+    row.Add("playerBytes", GetUInt32Value(PLAYER_BYTES));
+    row.Add("playerBytes2", GetUInt32Value(PLAYER_BYTES_2));
+    row.Add("playerFlags", GetUInt32Value(PLAYER_FLAGS));
 
     if(!IsBeingTeleported())
     {
-        ss << GetMapId() << ", "
-        << (uint32)GetDungeonDifficulty() << ", "
-        << finiteAlways(GetPositionX()) << ", "
-        << finiteAlways(GetPositionY()) << ", "
-        << finiteAlways(GetPositionZ()) << ", "
-        << finiteAlways(GetOrientation()) << ", ";
+        row.Add("map", GetMapId());
+        row.Add("dungeon_difficulty", (uint32)GetDungeonDifficulty());
+        row.Add("position_x", finiteAlways(GetPositionX()));
+        row.Add("position_y", finiteAlways(GetPositionY()));
+        row.Add("position_z", finiteAlways(GetPositionZ()));
+        row.Add("orientation", finiteAlways(GetOrientation()));
     }
     else
     {
-        ss << GetTeleportDest().mapid << ", "
-        << (uint32)GetDungeonDifficulty() << ", "
-        << finiteAlways(GetTeleportDest().coord_x) << ", "
-        << finiteAlways(GetTeleportDest().coord_y) << ", "
-        << finiteAlways(GetTeleportDest().coord_z) << ", "
-        << finiteAlways(GetTeleportDest().orientation) << ", ";
-    }
-
-    ss << m_taxi << ", ";                                   // string with TaxiMaskSize numbers
-
-    ss << (IsInWorld() ? 1 : 0) << ", ";
-
-    ss << m_cinematic << ", ";
-
-    ss << m_Played_time[PLAYED_TIME_TOTAL] << ", ";
-    ss << m_Played_time[PLAYED_TIME_LEVEL] << ", ";
-
-    ss << finiteAlways(m_rest_bonus) << ", ";
-    ss << (uint64)time(NULL) << ", ";
-    ss << (HasFlag(PLAYER_FLAGS, PLAYER_FLAGS_RESTING) ? 1 : 0) << ", ";
+        row.Add("map", GetTeleportDest().mapid);
+        row.Add("dungeon_difficulty", (uint32)GetDungeonDifficulty());
+        row.Add("position_x", finiteAlways(GetTeleportDest().coord_x));
+        row.Add("position_y", finiteAlways(GetTeleportDest().coord_y));
+        row.Add("position_z", finiteAlways(GetTeleportDest().coord_z));
+        row.Add("orientation", finiteAlways(GetTeleportDest().orientation));
+    }
+
+    row.Add("taximask", m_taxi);                            // string with TaxiMaskSize numbers
+    row.Add("online", IsInWorld() ? 1 : 0);
+    row.Add("cinematic", m_cinematic);
+    row.Add("totaltime", m_Played_time[PLAYED_TIME_TOTAL]);
+    row.Add("leveltime", m_Played_time[PLAYED_TIME_LEVEL]);
+    row.Add("rest_bonus", finiteAlways(m_rest_bonus));
+    row.Add("logout_time", (uint64)time(NULL));
+    row.Add("is_logout_resting", HasFlag(PLAYER_FLAGS, PLAYER_FLAGS_RESTING) ? 1 : 0);
                                                             //save, far from tavern/city
                                                             //save, but in tavern/city
-    ss << m_resetTalentsCost << ", ";
-    ss << (uint64)m_resetTalentsTime << ", ";
-
-    ss << finiteAlways(m_movementInfo.GetTransportPos()->x) << ", ";
-    ss << finiteAlways(m_movementInfo.GetTransportPos()->y) << ", ";
-    ss << finiteAlways(m_movementInfo.GetTransportPos()->z) << ", ";
-    ss << finiteAlways(m_movementInfo.GetTransportPos()->o) << ", ";
-    if (m_transport)
-        ss << m_transport->GetGUIDLow();
-    else
-        ss << "0";
-    ss << ", ";
-
-    ss << m_ExtraFlags << ", ";
-
-    ss << uint32(m_stableSlots) << ", ";                    // to prevent save uint8 as char
-
-    ss << uint32(m_atLoginFlags) << ", ";
-
-    ss << GetZoneId() << ", ";
-
-    ss << (uint64)m_deathExpireTime << ", '";
-
-    ss << m_taxi.SaveTaxiDestinationsToString() << "', ";
-
-    ss << GetArenaPoints() << ", ";
-
-    ss << GetHonorPoints() << ", ";
-
-    ss << GetUInt32Value(PLAYER_FIELD_TODAY_CONTRIBUTION)  << ", ";
-
-    ss << GetUInt32Value(PLAYER_FIELD_YESTERDAY_CONTRIBUTION) << ", ";
-
-    ss << GetUInt32Value(PLAYER_FIELD_LIFETIME_HONORBALE_KILLS) << ", ";
-
-    ss << GetUInt16Value(PLAYER_FIELD_KILLS, 0) << ", ";
-
-    ss << GetUInt16Value(PLAYER_FIELD_KILLS, 1) << ", ";
-
-    ss << GetUInt32Value(PLAYER_CHOSEN_TITLE) << ", ";
-
-    ss << GetUInt64Value(PLAYER_FIELD_KNOWN_CURRENCIES) << ", ";
+    row.Add("resettalents_cost", m_resetTalentsCost);
+    row.Add("resettalents_time", (uint64)m_resetTalentsTime);
+
+    row.Add("trans_x", finiteAlways(m_movementInfo.GetTransportPos()->x));
+    row.Add("trans_y", finiteAlways(m_movementInfo.GetTransportPos()->y));
+    row.Add("trans_z", finiteAlways(m_movementInfo.GetTransportPos()->z));
+    row.Add("trans_o", finiteAlways(m_movementInfo.GetTransportPos()->o));
+    row.Add("transguid", m_transport ? m_transport->GetGUIDLow() : 0);
+
+    row.Add("extra_flags", m_ExtraFlags);
+    row.Add("stable_slots", uint32(m_stableSlots));         // to prevent save uint8 as char
+    row.Add("at_login", uint32(m_atLoginFlags));
+    row.Add("zone", GetZoneId());
+    row.Add("death_expire_time", (uint64)m_deathExpireTime);
+    row.AddString("taxi_path", m_taxi.SaveTaxiDestinationsToString());
+    row.Add("arenaPoints", GetArenaPoints());
+    row.Add("totalHonorPoints", GetHonorPoints());
+    row.Add("todayHonorPoints", GetUInt32Value(PLAYER_FIELD_TODAY_CONTRIBUTION));
+    row.Add("yesterdayHonorPoints", GetUInt32Value(PLAYER_FIELD_YESTERDAY_CONTRIBUTION));
+    row.Add("totalKills", GetUInt32Value(PLAYER_FIELD_LIFETIME_HONORBALE_KILLS));
+    row.Add("todayKills", GetUInt16Value(PLAYER_FIELD_KILLS, 0));
+    row.Add("yesterdayKills", GetUInt16Value(PLAYER_FIELD_KILLS, 1));
+    row.Add("chosenTitle", GetUInt32Value(PLAYER_CHOSEN_TITLE));
+    row.Add("knownCurrencies", GetUInt64Value(PLAYER_FIELD_KNOWN_CURRENCIES));
 
     // FIXME: at this moment send to DB as unsigned, including unit32(-1)
-    ss << GetUInt32Value(PLAYER_FIELD_WATCHED_FACTION_INDEX) << ", ";
-
-    ss << (uint16)(GetUInt32Value(PLAYER_BYTES_3) & 0xFFFE) << ", ";
-
-    ss << GetHealth();
+    row.Add("watchedFaction", GetUInt32Value(PLAYER_FIELD_WATCHED_FACTION_INDEX));
+    row.Add("drunk", (uint16)(GetUInt32Value(PLAYER_BYTES_3) & 0xFFFE));
+    row.Add("health", GetHealth());
 
+    static char const* powerColumns[MAX_POWERS] = { "power1", "power2", "power3", "power4", "power5", "power6", "power7" };
     for(uint32 i = 0; i < MAX_POWERS; ++i)
-        ss << "," << GetPower(Powers(i));
+        row.Add(powerColumns[i], GetPower(Powers(i)));
 
-    ss << ", ";
-    ss << uint32(m_specsCount) << ", ";
-    ss << uint32(m_activeSpec) << ", '";
-    for(uint32 i = 0; i < PLAYER_EXPLORED_ZONES_SIZE; ++i )
-    {
-        ss << GetUInt32Value(PLAYER_EXPLORED_ZONES_1 + i) << " ";
-    }
+    row.Add("specCount", uint32(m_specsCount));
+    row.Add("activeSpec", uint32(m_activeSpec));
 
-    ss << "', '";
-    for(uint32 i = 0; i < EQUIPMENT_SLOT_END * 2; ++i )
-    {
-        ss << GetUInt32Value(PLAYER_VISIBLE_ITEM_1_ENTRYID + i) << " ";
-    }
+    row.AddString("exploredZones", UInt32ArrayToString(&m_uint32Values[PLAYER_EXPLORED_ZONES_1], PLAYER_EXPLORED_ZONES_SIZE));
+    row.AddString("equipmentCache", UInt32ArrayToString(&m_uint32Values[PLAYER_VISIBLE_ITEM_1_ENTRYID], EQUIPMENT_SLOT_END * 2));
+    row.Add("ammoId", GetUInt32Value(PLAYER_AMMO_ID));
+    row.AddString("knownTitles", UInt32ArrayToString(&m_uint32Values[PLAYER__FIELD_KNOWN_TITLES], KNOWN_TITLES_SIZE * 2));
+
+    row.Add("actionBars", uint32(GetByteValue(PLAYER_FIELD_BYTES, 2)));
 
-    ss << "',";
-    ss << GetUInt32Value(PLAYER_AMMO_ID) << ", '";
-    for(uint32 i = 0; i < KNOWN_TITLES_SIZE*2; ++i )
+    // row exist after first save or load, update it in place
+    if (m_savedSections & PLAYER_SAVED_CHARACTER)
+        ExecuteSave(row.GetUpdateStatement("characters", "guid", GetGUIDLow()));
+    else
     {
-        ss << GetUInt32Value(PLAYER__FIELD_KNOWN_TITLES + i) << " ";
+        PExecuteSave("DELETE FROM characters WHERE guid = '%u'",GetGUIDLow());
+        ExecuteSave(row.GetInsertStatement("characters"));
+        m_savedSections |= PLAYER_SAVED_CHARACTER;
     }
-    ss << "',";
-    ss << uint32(GetByteValue(PLAYER_FIELD_BYTES, 2));
-    ss << ")";
-
-    CharacterDatabase.Execute( ss.str().c_str() );
 
     if (m_mailsUpdated)                                     //save mails only when needed
         _SaveMail();
@@ -16880,6 +16982,7 @@ void Player::SaveToDB()
     _SaveGlyphs();
     _SaveTalents();
 
+    m_saveRows += sPersistenceMgr.WriteBatch();
     CharacterDatabase.CommitTransaction();
 
     // check if stats should only be saved on logout
@@ -16887,6 +16990,11 @@ void Player::SaveToDB()
     if (m_session->isLogingOut() || !sWorld.getConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT))
         _SaveStats();
 
+    ++m_totalSaves;
+    m_totalSaveStatements += m_saveStatements;
+    m_totalSaveRows += m_saveRows;
+    DEBUG_LOG("Player %s (GUID: %u) saved, %u statements executed, %u rows written", m_name.c_str(), GetGUIDLow(), m_saveStatements, m_saveRows);
+
     // save pet (hunter pet level and experience and all type pets health/mana).
     if (Pet* pet = GetPet())
         pet->SavePetToDB(PET_SAVE_AS_CURRENT);
@@ -16913,19 +17021,19 @@ void Player::_SaveActions()
             switch (itr->second.uState)
             {
                 case ACTIONBUTTON_NEW:
-                    CharacterDatabase.PExecute("INSERT INTO character_action (guid,spec, button,action,type) VALUES ('%u', '%u', '%u', '%u', '%u')",
+                    PExecuteSave("INSERT INTO character_action (guid,spec, button,action,type) VALUES ('%u', '%u', '%u', '%u', '%u')",
                         GetGUIDLow(), i, (uint32)itr->first, (uint32)itr->second.GetAction(), (uint32)itr->second.GetType() );
                     itr->second.uState = ACTIONBUTTON_UNCHANGED;
                     ++itr;
                     break;
                 case ACTIONBUTTON_CHANGED:
-                    CharacterDatabase.PExecute("UPDATE character_action  SET action = '%u', type = '%u' WHERE guid= '%u' AND button= '%u' AND spec = '%u'",
+                    PExecuteSave("UPDATE character_action  SET action = '%u', type = '%u' WHERE guid= '%u' AND button= '%u' AND spec = '%u'",
                         (uint32)itr->second.GetAction(), (uint32)itr->second.GetType(), GetGUIDLow(), (uint32)itr->first, i );
                     itr->second.uState = ACTIONBUTTON_UNCHANGED;
                     ++itr;
                     break;
                 case ACTIONBUTTON_DELETED:
-                    CharacterDatabase.PExecute("DELETE FROM character_action WHERE guid = '%u' AND button = '%u' AND spec = '%u'", GetGUIDLow(), (uint32)itr->first, i);
+                    PExecuteSave("DELETE FROM character_action WHERE guid = '%u' AND button = '%u' AND spec = '%u'", GetGUIDLow(), (uint32)itr->first, i);
                     m_actionButtons[i].erase(itr++);
                     break;
                 default:
@@ -16938,15 +17046,9 @@ void Player::_SaveActions()
 
 void Player::_SaveAuras()
 {
-    CharacterDatabase.PExecute("DELETE FROM character_aura WHERE guid = '%u'",GetGUIDLow());
+    SavedAuraMap auras;
 
     SpellAuraHolderMap const& auraHolders = GetSpellAuraHolderMap();
-
-    if (auraHolders.empty())
-        return;
-
-    /* copied following sql-code partly from achievementmgr */
-
     for(SpellAuraHolderMap::const_iterator itr = auraHolders.begin(); itr != auraHolders.end(); ++itr)
     {
         SpellAuraHolder *holder = itr->second;
@@ -16954,16 +17056,16 @@ void Player::_SaveAuras()
         //do not save single target holders (unless they were cast by the player)
         if (!holder->IsPassive() && (holder->GetCasterGUID() == GetGUID() || !holder->IsSingleTarget()))
         {
-            int32 damage[MAX_EFFECT_INDEX];
-            int32 remaintime[MAX_EFFECT_INDEX];
-            int32 maxduration[MAX_EFFECT_INDEX];
-            uint32 effIndexMask = 0;
+            SavedAuraData data;
+            data.stackCount = holder->GetStackAmount();
+            data.charges = holder->GetAuraCharges();
+            data.effIndexMask = 0;
 
             for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
             {
-                damage[i] = 0;
-                remaintime[i] = 0;
-                maxduration[i] = 0;
+                data.damage[i] = 0;
+                data.remainTime[i] = 0;
+                data.maxDuration[i] = 0;
 
                 if (Aura *aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
                 {
@@ -16971,25 +17073,67 @@ void Player::_SaveAuras()
                     if (aur->IsAreaAura() && holder->GetCasterGUID() != GetGUID())
                         continue;
 
-                    damage[i] = aur->GetModifier()->m_amount;
-                    remaintime[i] = aur->GetAuraDuration();
-                    maxduration[i] = aur->GetAuraMaxDuration();
-                    effIndexMask |= (1 << i);
+                    data.damage[i] = aur->GetModifier()->m_amount;
+                    data.remainTime[i] = aur->GetAuraDuration();
+                    data.maxDuration[i] = aur->GetAuraMaxDuration();
+                    data.effIndexMask |= (1 << i);
                 }
             }
 
-            if (!effIndexMask)
+            if (!data.effIndexMask)
                 continue;
 
-            CharacterDatabase.PExecute("INSERT INTO character_aura (guid, caster_guid, item_guid, spell, stackcount, remaincharges, basepoints0, basepoints1, basepoints2, maxduration0, maxduration1, maxduration2, remaintime0, remaintime1, remaintime2, effIndexMask) VALUES "
-                "('%u', '" UI64FMTD "', '%u', '%u', '%u', '%u', '%d', '%d', '%d', '%d', '%d', '%d', '%d', '%d', '%d', '%u')",
-                GetGUIDLow(), holder->GetCasterGUID(), GUID_LOPART(holder->GetCastItemGUID()), holder->GetId(), holder->GetStackAmount(), holder->GetAuraCharges(),
-                damage[EFFECT_INDEX_0], damage[EFFECT_INDEX_1], damage[EFFECT_INDEX_2],
-                maxduration[EFFECT_INDEX_0], maxduration[EFFECT_INDEX_1], maxduration[EFFECT_INDEX_2],
-                remaintime[EFFECT_INDEX_0], remaintime[EFFECT_INDEX_1], remaintime[EFFECT_INDEX_2],
-                effIndexMask);
+            auras.insert(SavedAuraMap::value_type(SavedAuraKey(holder->GetCasterGUID(), GUID_LOPART(holder->GetCastItemGUID()), holder->GetId()), data));
+        }
+    }
+
+    bool synced = m_savedSections & PLAYER_SAVED_AURAS;
+    if (!synced)
+        PExecuteSave("DELETE FROM character_aura WHERE guid = '%u'",GetGUIDLow());
+    else
+    {
+        // removed since last save
+        for(SavedAuraMap::const_iterator itr = m_savedAuras.begin(); itr != m_savedAuras.end(); ++itr)
+            if (auras.find(itr->first) == auras.end())
+                PExecuteSave("DELETE FROM character_aura WHERE guid = '%u' AND caster_guid = '" UI64FMTD "' AND item_guid = '%u' AND spell = '%u'",
+                    GetGUIDLow(), itr->first.caster, itr->first.item, itr->first.spell);
+    }
+
+    for(SavedAuraMap::const_iterator itr = auras.begin(); itr != auras.end(); ++itr)
+    {
+        SavedAuraKey const& key = itr->first;
+        SavedAuraData const& data = itr->second;
+
+        if (synced)
+        {
+            SavedAuraMap::const_iterator saved = m_savedAuras.find(key);
+            if (saved != m_savedAuras.end())
+            {
+                // mostly only remaining time changed for timed auras, permanent auras skipped
+                if (!(saved->second == data))
+                    PExecuteSave("UPDATE character_aura SET stackcount = '%u', remaincharges = '%u', basepoints0 = '%d', basepoints1 = '%d', basepoints2 = '%d', "
+                        "maxduration0 = '%d', maxduration1 = '%d', maxduration2 = '%d', remaintime0 = '%d', remaintime1 = '%d', remaintime2 = '%d', effIndexMask = '%u' "
+                        "WHERE guid = '%u' AND caster_guid = '" UI64FMTD "' AND item_guid = '%u' AND spell = '%u'",
+                        data.stackCount, data.charges,
+                        data.damage[EFFECT_INDEX_0], data.damage[EFFECT_INDEX_1], data.damage[EFFECT_INDEX_2],
+                        data.maxDuration[EFFECT_INDEX_0], data.maxDuration[EFFECT_INDEX_1], data.maxDuration[EFFECT_INDEX_2],
+                        data.remainTime[EFFECT_INDEX_0], data.remainTime[EFFECT_INDEX_1], data.remainTime[EFFECT_INDEX_2],
+                        data.effIndexMask, GetGUIDLow(), key.caster, key.item, key.spell);
+                continue;
+            }
         }
+
+        PExecuteSave("INSERT INTO character_aura (guid, caster_guid, item_guid, spell, stackcount, remaincharges, basepoints0, basepoints1, basepoints2, maxduration0, maxduration1, maxduration2, remaintime0, remaintime1, remaintime2, effIndexMask) VALUES "
+            "('%u', '" UI64FMTD "', '%u', '%u', '%u', '%u', '%d', '%d', '%d', '%d', '%d', '%d', '%d', '%d', '%d', '%u')",
+            GetGUIDLow(), key.caster, key.item, key.spell, data.stackCount, data.charges,
+            data.damage[EFFECT_INDEX_0], data.damage[EFFECT_INDEX_1], data.damage[EFFECT_INDEX_2],
+            data.maxDuration[EFFECT_INDEX_0], data.maxDuration[EFFECT_INDEX_1], data.maxDuration[EFFECT_INDEX_2],
+            data.remainTime[EFFECT_INDEX_0], data.remainTime[EFFECT_INDEX_1], data.remainTime[EFFECT_INDEX_2],
+            data.effIndexMask);
     }
+
+    m_savedAuras.swap(auras);
+    m_savedSections |= PLAYER_SAVED_AURAS;
 }
 
 void Player::_SaveGlyphs()
@@ -17002,13 +17146,13 @@ void Player::_SaveGlyphs()
             switch(m_glyphs[spec][slot].uState)
             {
                 case GLYPH_NEW:
-                    CharacterDatabase.PExecute("INSERT INTO character_glyphs (guid, spec, slot, glyph) VALUES ('%u', '%u', '%u', '%u')", GetGUIDLow(), spec, slot, m_glyphs[spec][slot].GetId());
+                    PExecuteSave("INSERT INTO character_glyphs (guid, spec, slot, glyph) VALUES ('%u', '%u', '%u', '%u')", GetGUIDLow(), spec, slot, m_glyphs[spec][slot].GetId());
                     break;
                 case GLYPH_CHANGED:
-                    CharacterDatabase.PExecute("UPDATE character_glyphs SET glyph = '%u' WHERE guid='%u' AND spec = '%u' AND slot = '%u'", m_glyphs[spec][slot].GetId(), GetGUIDLow(), spec, slot);
+                    PExecuteSave("UPDATE character_glyphs SET glyph = '%u' WHERE guid='%u' AND spec = '%u' AND slot = '%u'", m_glyphs[spec][slot].GetId(), GetGUIDLow(), spec, slot);
                     break;
                 case GLYPH_DELETED:
-                    CharacterDatabase.PExecute("DELETE FROM character_glyphs WHERE guid='%u' AND spec = '%u' AND slot = '%u'",GetGUIDLow(), spec, slot);
+                    PExecuteSave("DELETE FROM character_glyphs WHERE guid='%u' AND spec = '%u' AND slot = '%u'",GetGUIDLow(), spec, slot);
                     break;
                 case GLYPH_UNCHANGED:
                     break;
@@ -17026,8 +17170,8 @@ void Player::_SaveInventory()
     {
         Item *item = m_items[i];
         if (!item || item->GetState() == ITEM_NEW) continue;
-        CharacterDatabase.PExecute("DELETE FROM character_inventory WHERE item = '%u'", item->GetGUIDLow());
-        CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid = '%u'", item->GetGUIDLow());
+        PExecuteSave("DELETE FROM character_inventory WHERE item = '%u'", item->GetGUIDLow());
+        PExecuteSave("DELETE FROM item_instance WHERE guid = '%u'", item->GetGUIDLow());
         m_items[i]->FSetState(ITEM_NEW);
     }
 
@@ -17078,13 +17222,13 @@ void Player::_SaveInventory()
         switch(item->GetState())
         {
             case ITEM_NEW:
-                CharacterDatabase.PExecute("INSERT INTO character_inventory (guid,bag,slot,item,item_template) VALUES ('%u', '%u', '%u', '%u', '%u')", GetGUIDLow(), bag_guid, item->GetSlot(), item->GetGUIDLow(), item->GetEntry());
+                PExecuteSave("INSERT INTO character_inventory (guid,bag,slot,item,item_template) VALUES ('%u', '%u', '%u', '%u', '%u')", GetGUIDLow(), bag_guid, item->GetSlot(), item->GetGUIDLow(), item->GetEntry());
                 break;
             case ITEM_CHANGED:
-                CharacterDatabase.PExecute("UPDATE character_inventory SET guid='%u', bag='%u', slot='%u', item_template='%u' WHERE item='%u'", GetGUIDLow(), bag_guid, item->GetSlot(), item->GetEntry(), item->GetGUIDLow());
+                PExecuteSave("UPDATE character_inventory SET guid='%u', bag='%u', slot='%u', item_template='%u' WHERE item='%u'", GetGUIDLow(), bag_guid, item->GetSlot(), item->GetEntry(), item->GetGUIDLow());
                 break;
             case ITEM_REMOVED:
-                CharacterDatabase.PExecute("DELETE FROM character_inventory WHERE item = '%u'", item->GetGUIDLow());
+                PExecuteSave("DELETE FROM character_inventory WHERE item = '%u'", item->GetGUIDLow());
                 break;
             case ITEM_UNCHANGED:
                 break;
@@ -17102,12 +17246,12 @@ void Player::_SaveMail()
         Mail *m = (*itr);
         if (m->state == MAIL_STATE_CHANGED)
         {
-            CharacterDatabase.PExecute("UPDATE mail SET has_items = '%u',expire_time = '" UI64FMTD "', deliver_time = '" UI64FMTD "',money = '%u',cod = '%u',checked = '%u' WHERE id = '%u'",
+            PExecuteSave("UPDATE mail SET has_items = '%u',expire_time = '" UI64FMTD "', deliver_time = '" UI64FMTD "',money = '%u',cod = '%u',checked = '%u' WHERE id = '%u'",
                 m->HasItems() ? 1 : 0, (uint64)m->expire_time, (uint64)m->deliver_time, m->money, m->COD, m->checked, m->messageID);
             if(m->removedItems.size())
             {
                 for(std::vector<uint32>::const_iterator itr2 = m->removedItems.begin(); itr2 != m->removedItems.end(); ++itr2)
-                    CharacterDatabase.PExecute("DELETE FROM mail_items WHERE item_guid = '%u'", *itr2);
+                    PExecuteSave("DELETE FROM mail_items WHERE item_guid = '%u'", *itr2);
                 m->removedItems.clear();
             }
             m->state = MAIL_STATE_UNCHANGED;
@@ -17116,10 +17260,10 @@ void Player::_SaveMail()
         {
             if (m->HasItems())
                 for(std::vector<MailItemInfo>::const_iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                    CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid = '%u'", itr2->item_guid);
+                    PExecuteSave("DELETE FROM item_instance WHERE guid = '%u'", itr2->item_guid);
 
-            CharacterDatabase.PExecute("DELETE FROM mail WHERE id = '%u'", m->messageID);
-            CharacterDatabase.PExecute("DELETE FROM mail_items WHERE mail_id = '%u'", m->messageID);
+            PExecuteSave("DELETE FROM mail WHERE id = '%u'", m->messageID);
+            PExecuteSave("DELETE FROM mail_items WHERE mail_id = '%u'", m->messageID);
         }
     }
 
@@ -17148,12 +17292,12 @@ void Player::_SaveQuestStatus()
         switch (i->second.uState)
         {
             case QUEST_NEW :
-                CharacterDatabase.PExecute("INSERT INTO character_queststatus (guid,quest,status,rewarded,explored,timer,mobcount1,mobcount2,mobcount3,mobcount4,itemcount1,itemcount2,itemcount3,itemcount4) "
+                PExecuteSave("INSERT INTO character_queststatus (guid,quest,status,rewarded,explored,timer,mobcount1,mobcount2,mobcount3,mobcount4,itemcount1,itemcount2,itemcount3,itemcount4) "
                     "VALUES ('%u', '%u', '%u', '%u', '%u', '" UI64FMTD "', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u')",
                     GetGUIDLow(), i->first, i->second.m_status, i->second.m_rewarded, i->second.m_explored, uint64(i->second.m_timer / IN_MILLISECONDS+ sWorld.GetGameTime()), i->second.m_creatureOrGOcount[0], i->second.m_creatureOrGOcount[1], i->second.m_creatureOrGOcount[2], i->second.m_creatureOrGOcount[3], i->second.m_itemcount[0], i->second.m_itemcount[1], i->second.m_itemcount[2], i->second.m_itemcount[3]);
                 break;
             case QUEST_CHANGED :
-                CharacterDatabase.PExecute("UPDATE character_queststatus SET status = '%u',rewarded = '%u',explored = '%u',timer = '" UI64FMTD "',mobcount1 = '%u',mobcount2 = '%u',mobcount3 = '%u',mobcount4 = '%u',itemcount1 = '%u',itemcount2 = '%u',itemcount3 = '%u',itemcount4 = '%u'  WHERE guid = '%u' AND quest = '%u' ",
+                PExecuteSave("UPDATE character_queststatus SET status = '%u',rewarded = '%u',explored = '%u',timer = '" UI64FMTD "',mobcount1 = '%u',mobcount2 = '%u',mobcount3 = '%u',mobcount4 = '%u',itemcount1 = '%u',itemcount2 = '%u',itemcount3 = '%u',itemcount4 = '%u'  WHERE guid = '%u' AND quest = '%u' ",
                     i->second.m_status, i->second.m_rewarded, i->second.m_explored, uint64(i->second.m_timer / IN_MILLISECONDS + sWorld.GetGameTime()), i->second.m_creatureOrGOcount[0], i->second.m_creatureOrGOcount[1], i->second.m_creatureOrGOcount[2], i->second.m_creatureOrGOcount[3], i->second.m_itemcount[0], i->second.m_itemcount[1], i->second.m_itemcount[2], i->second.m_itemcount[3], GetGUIDLow(), i->first );
                 break;
             case QUEST_UNCHANGED:
@@ -17169,10 +17313,10 @@ void Player::_SaveDailyQuestStatus()
         return;
 
     // we don't need transactions here.
-    CharacterDatabase.PExecute("DELETE FROM character_queststatus_daily WHERE guid = '%u'",GetGUIDLow());
+    PExecuteSave("DELETE FROM character_queststatus_daily WHERE guid = '%u'",GetGUIDLow());
     for(uint32 quest_daily_idx = 0; quest_daily_idx < PLAYER_MAX_DAILY_QUESTS; ++quest_daily_idx)
         if (GetUInt32Value(PLAYER_FIELD_DAILY_QUESTS_1+quest_daily_idx))
-            CharacterDatabase.PExecute("INSERT INTO character_queststatus_daily (guid,quest) VALUES ('%u', '%u')",
+            PExecuteSave("INSERT INTO character_queststatus_daily (guid,quest) VALUES ('%u', '%u')",
                 GetGUIDLow(), GetUInt32Value(PLAYER_FIELD_DAILY_QUESTS_1+quest_daily_idx));
 
     m_DailyQuestChanged = false;
@@ -17184,13 +17328,13 @@ void Player::_SaveWeeklyQuestStatus()
         return;
 
     // we don't need transactions here.
-    CharacterDatabase.PExecute("DELETE FROM character_queststatus_weekly WHERE guid = '%u'",GetGUIDLow());
+    PExecuteSave("DELETE FROM character_queststatus_weekly WHERE guid = '%u'",GetGUIDLow());
 
     for (QuestSet::const_iterator iter = m_weeklyquests.begin(); iter != m_weeklyquests.end(); ++iter)
     {
         uint32 quest_id  = *iter;
 
-        CharacterDatabase.PExecute("INSERT INTO character_queststatus_weekly (guid,quest) VALUES ('%u', '%u')", GetGUIDLow(), quest_id);
+        PExecuteSave("INSERT INTO character_queststatus_weekly (guid,quest) VALUES ('%u', '%u')", GetGUIDLow(), quest_id);
     }
 
     m_WeeklyQuestChanged = false;
@@ -17209,7 +17353,7 @@ void Player::_SaveSkills()
 
         if(itr->second.uState == SKILL_DELETED)
         {
-            CharacterDatabase.PExecute("DELETE FROM character_skills WHERE guid = '%u' AND skill = '%u' ", GetGUIDLow(), itr->first );
+            PExecuteSave("DELETE FROM character_skills WHERE guid = '%u' AND skill = '%u' ", GetGUIDLow(), itr->first );
             mSkillStatus.erase(itr++);
             continue;
         }
@@ -17221,11 +17365,11 @@ void Player::_SaveSkills()
         switch (itr->second.uState)
         {
             case SKILL_NEW:
-                CharacterDatabase.PExecute("INSERT INTO character_skills (guid, skill, value, max) VALUES ('%u', '%u', '%u', '%u')",
+                PExecuteSave("INSERT INTO character_skills (guid, skill, value, max) VALUES ('%u', '%u', '%u', '%u')",
                     GetGUIDLow(), itr->first, value, max);
                 break;
             case SKILL_CHANGED:
-                CharacterDatabase.PExecute("UPDATE character_skills SET value = '%u',max = '%u'WHERE guid = '%u' AND skill = '%u' ",
+                PExecuteSave("UPDATE character_skills SET value = '%u',max = '%u'WHERE guid = '%u' AND skill = '%u' ",
                     value, max, GetGUIDLow(), itr->first );
                 break;
         };
@@ -17244,11 +17388,11 @@ void Player::_SaveSpells()
         if (!talentCosts)
         {
             if (itr->second.state == PLAYERSPELL_REMOVED || itr->second.state == PLAYERSPELL_CHANGED)
-                CharacterDatabase.PExecute("DELETE FROM character_spell WHERE guid = '%u' and spell = '%u'", GetGUIDLow(), itr->first);
+                PExecuteSave("DELETE FROM character_spell WHERE guid = '%u' and spell = '%u'", GetGUIDLow(), itr->first);
 
             // add only changed/new not dependent spells
             if (!itr->second.dependent && (itr->second.state == PLAYERSPELL_NEW || itr->second.state == PLAYERSPELL_CHANGED))
-                CharacterDatabase.PExecute("INSERT INTO character_spell (guid,spell,active,disabled) VALUES ('%u', '%u', '%u', '%u')", GetGUIDLow(), itr->first, itr->second.active ? 1 : 0,itr->second.disabled ? 1 : 0);
+                PExecuteSave("INSERT INTO character_spell (guid,spell,active,disabled) VALUES ('%u', '%u', '%u', '%u')", GetGUIDLow(), itr->first, itr->second.active ? 1 : 0,itr->second.disabled ? 1 : 0);
         }
 
         if (itr->second.state == PLAYERSPELL_REMOVED)
@@ -17269,11 +17413,11 @@ void Player::_SaveTalents()
         for (PlayerTalentMap::iterator itr = m_talents[i].begin(); itr != m_talents[i].end();)
         {
             if (itr->second.state == PLAYERSPELL_REMOVED || itr->second.state == PLAYERSPELL_CHANGED)
-                CharacterDatabase.PExecute("DELETE FROM character_talent WHERE guid = '%u' and talent_id = '%u' and spec = '%u'", GetGUIDLow(),itr->first, i);
+                PExecuteSave("DELETE FROM character_talent WHERE guid = '%u' and talent_id = '%u' and spec = '%u'", GetGUIDLow(),itr->first, i);
 
             // add only changed/new talents
             if (itr->second.state == PLAYERSPELL_NEW || itr->second.state == PLAYERSPELL_CHANGED)
-                CharacterDatabase.PExecute("INSERT INTO character_talent (guid, talent_id, current_rank , spec) VALUES ('%u', '%u', '%u', '%u')", GetGUIDLow(), itr->first, itr->second.currentRank, i);
+                PExecuteSave("INSERT INTO character_talent (guid, talent_id, current_rank , spec) VALUES ('%u', '%u', '%u', '%u')", GetGUIDLow(), itr->first, itr->second.currentRank, i);
 
             if (itr->second.state == PLAYERSPELL_REMOVED)
                 m_talents[i].erase(itr++);
@@ -17294,12 +17438,8 @@ void Player::_SaveStats()
     if(!sWorld.getConfig(CONFIG_UINT32_MIN_LEVEL_STAT_SAVE) || getLevel() < sWorld.getConfig(CONFIG_UINT32_MIN_LEVEL_STAT_SAVE))
         return;
 
-    CharacterDatabase.PExecute("DELETE FROM character_stats WHERE guid = '%u'", GetGUIDLow());
     std::ostringstream ss;
-    ss << "INSERT INTO character_stats (guid, maxhealth, maxpower1, maxpower2, maxpower3, maxpower4, maxpower5, maxpower6, maxpower7, "
-        "strength, agility, stamina, intellect, spirit, armor, resHoly, resFire, resNature, resFrost, resShadow, resArcane, "
-        "blockPct, dodgePct, parryPct, critPct, rangedCritPct, spellCritPct, attackPower, rangedAttackPower, spellPower) VALUES ("
-        << GetGUIDLow() << ", "
+    ss << GetGUIDLow() << ", "
         << GetMaxHealth() << ", ";
     for(int i = 0; i < MAX_POWERS; ++i)
         ss << GetMaxPower(Powers(i)) << ", ";
@@ -17316,8 +17456,20 @@ void Player::_SaveStats()
        << GetFloatValue(PLAYER_SPELL_CRIT_PERCENTAGE1) << ", "
        << GetUInt32Value(UNIT_FIELD_ATTACK_POWER) << ", "
        << GetUInt32Value(UNIT_FIELD_RANGED_ATTACK_POWER) << ", "
-       << GetBaseSpellPowerBonus() << ")";
-    CharacterDatabase.Execute( ss.str().c_str() );
+       << GetBaseSpellPowerBonus();
+
+    // stats not changed since last save
+    std::string values = ss.str();
+    if (values == m_savedStats)
+        return;
+
+    PExecuteSave("DELETE FROM character_stats WHERE guid = '%u'", GetGUIDLow());
+    ExecuteSave("INSERT INTO character_stats (guid, maxhealth, maxpower1, maxpower2, maxpower3, maxpower4, maxpower5, maxpower6, maxpower7, "
+        "strength, agility, stamina, intellect, spirit, armor, resHoly, resFire, resNature, resFrost, resShadow, resArcane, "
+        "blockPct, dodgePct, parryPct, critPct, rangedCritPct, spellCritPct, attackPower, rangedAttackPower, spellPower) VALUES ("
+        + values + ")");
+
+    m_savedStats = values;
 }
 
 void Player::outDebugStatsValues() const
@@ -21890,7 +22042,7 @@ void Player::_SaveEquipmentSets()
                 std::string db_Name = eqset.Name;
                 CharacterDatabase.escape_string(db_IconName);
                 CharacterDatabase.escape_string(db_Name);
-                CharacterDatabase.PExecute("UPDATE character_equipmentsets SET name='%s', iconname='%s', item0='%u', item1='%u', item2='%u', item3='%u', item4='%u', item5='%u', item6='%u', item7='%u', item8='%u', item9='%u', item10='%u', item11='%u', item12='%u', item13='%u', item14='%u', item15='%u', item16='%u', item17='%u', item18='%u' WHERE guid='%u' AND setguid='"UI64FMTD"' AND setindex='%u'",
+                PExecuteSave("UPDATE character_equipmentsets SET name='%s', iconname='%s', item0='%u', item1='%u', item2='%u', item3='%u', item4='%u', item5='%u', item6='%u', item7='%u', item8='%u', item9='%u', item10='%u', item11='%u', item12='%u', item13='%u', item14='%u', item15='%u', item16='%u', item17='%u', item18='%u' WHERE guid='%u' AND setguid='"UI64FMTD"' AND setindex='%u'",
                     db_Name.c_str(), db_IconName.c_str(), eqset.Items[0], eqset.Items[1], eqset.Items[2], eqset.Items[3], eqset.Items[4], eqset.Items[5], eqset.Items[6], eqset.Items[7],
                     eqset.Items[8], eqset.Items[9], eqset.Items[10], eqset.Items[11], eqset.Items[12], eqset.Items[13], eqset.Items[14], eqset.Items[15], eqset.Items[16], eqset.Items[17], eqset.Items[18], GetGUIDLow(), eqset.Guid, index);
                 eqset.state = EQUIPMENT_SET_UNCHANGED;
@@ -21904,7 +22056,7 @@ void Player::_SaveEquipmentSets()
                 std::string db_Name = eqset.Name;
                 CharacterDatabase.escape_string(db_IconName);
                 CharacterDatabase.escape_string(db_Name);
-                CharacterDatabase.PExecute("INSERT INTO character_equipmentsets VALUES ('%u', '"UI64FMTD"', '%u', '%s', '%s', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u')",
+                PExecuteSave("INSERT INTO character_equipmentsets VALUES ('%u', '"UI64FMTD"', '%u', '%s', '%s', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u', '%u')",
                     GetGUIDLow(), eqset.Guid, index, db_Name.c_str(), db_IconName.c_str(), eqset.Items[0], eqset.Items[1], eqset.Items[2], eqset.Items[3], eqset.Items[4], eqset.Items[5], eqset.Items[6], eqset.Items[7],
                     eqset.Items[8], eqset.Items[9], eqset.Items[10], eqset.Items[11], eqset.Items[12], eqset.Items[13], eqset.Items[14], eqset.Items[15], eqset.Items[16], eqset.Items[17], eqset.Items[18]);
                 eqset.state = EQUIPMENT_SET_UNCHANGED;
@@ -21912,7 +22064,7 @@ void Player::_SaveEquipmentSets()
                 break;
             }
             case EQUIPMENT_SET_DELETED:
-                CharacterDatabase.PExecute("DELETE FROM character_equipmentsets WHERE setguid="UI64FMTD, eqset.Guid);
+                PExecuteSave("DELETE FROM character_equipmentsets WHERE setguid="UI64FMTD, eqset.Guid);
                 m_EquipmentSets.erase(itr++);
                 break;
         }
@@ -21921,14 +22073,21 @@ void Player::_SaveEquipmentSets()
 
 void Player::_SaveBGData()
 {
-    CharacterDatabase.PExecute("DELETE FROM character_battleground_data WHERE guid='%u'", GetGUIDLow());
+    /* guid, bgInstanceID, bgTeam, x, y, z, o, map, taxi[0], taxi[1], mountSpell */
+    char values[256];
+    snprintf(values, 256, "'%u', '%u', '%u', '%f', '%f', '%f', '%f', '%u', '%u', '%u', '%u'",
+        GetGUIDLow(), m_bgData.bgInstanceID, m_bgData.bgTeam, m_bgData.joinPos.coord_x, m_bgData.joinPos.coord_y, m_bgData.joinPos.coord_z,
+        m_bgData.joinPos.orientation, m_bgData.joinPos.mapid, m_bgData.taxiPath[0], m_bgData.taxiPath[1], m_bgData.mountSpell);
+
+    // not changed since last save
+    if (m_savedBGData == values)
+        return;
+
+    PExecuteSave("DELETE FROM character_battleground_data WHERE guid='%u'", GetGUIDLow());
     if (m_bgData.bgInstanceID)
-    {
-        /* guid, bgInstanceID, bgTeam, x, y, z, o, map, taxi[0], taxi[1], mountSpell */
-        CharacterDatabase.PExecute("INSERT INTO character_battleground_data VALUES ('%u', '%u', '%u', '%f', '%f', '%f', '%f', '%u', '%u', '%u', '%u')",
-            GetGUIDLow(), m_bgData.bgInstanceID, m_bgData.bgTeam, m_bgData.joinPos.coord_x, m_bgData.joinPos.coord_y, m_bgData.joinPos.coord_z,
-            m_bgData.joinPos.orientation, m_bgData.joinPos.mapid, m_bgData.taxiPath[0], m_bgData.taxiPath[1], m_bgData.mountSpell);
-    }
+        PExecuteSave("INSERT INTO character_battleground_data VALUES (%s)", values);
+
+    m_savedBGData = values;
 }
 
 void Player::DeleteEquipmentSet(uint64 setGuid)
@@ -149,6 +149,48 @@ struct SpellCooldown
 
 typedef std::map<uint32, SpellCooldown> SpellCooldowns;
 
+// character data sections with DB state known at server side, used for write only changed rows at save
+enum PlayerSavedSections
+{
+    PLAYER_SAVED_CHARACTER      = 0x01,                     // `characters` row exist
+    PLAYER_SAVED_AURAS          = 0x02,                     // `character_aura` rows match m_savedAuras
+    PLAYER_SAVED_COOLDOWNS      = 0x04,                     // `character_spell_cooldown` rows match m_savedCooldowns
+};
+
+// `character_aura` primary key for player
+struct SavedAuraKey
+{
+    SavedAuraKey(uint64 _caster, uint32 _item, uint32 _spell) : caster(_caster), item(_item), spell(_spell) {}
+
+    uint64 caster;
+    uint32 item;
+    uint32 spell;
+
+    bool operator<(SavedAuraKey const& other) const
+    {
+        if (caster != other.caster)
+            return caster < other.caster;
+        if (item != other.item)
+            return item < other.item;
+        return spell < other.spell;
+    }
+};
+
+// `character_aura` row data
+struct SavedAuraData
+{
+    uint32 stackCount;
+    uint32 charges;
+    int32 damage[MAX_EFFECT_INDEX];
+    int32 maxDuration[MAX_EFFECT_INDEX];
+    int32 remainTime[MAX_EFFECT_INDEX];
+    uint32 effIndexMask;
+
+    bool operator==(SavedAuraData const& other) const { return memcmp(this, &other, sizeof(SavedAuraData)) == 0; }
+};
+
+typedef std::map<SavedAuraKey, SavedAuraData> SavedAuraMap;
+
 enum TrainerSpellState
 {
     TRAINER_SPELL_GREEN = 0,
@@ -1533,6 +1575,14 @@ class MANGOS_DLL_SPEC Player : public Unit
         void SaveToDB();
         void SaveInventoryAndGoldToDB();                    // fast save function for item/money cheating preventing
         void SaveGoldToDB();
+        // saves, executed save statements and rows written by them since server start
+        static uint32 GetTotalSaves() { return m_totalSaves; }
+        static uint64 GetTotalSaveStatements() { return m_totalSaveStatements; }
+        static uint64 GetTotalSaveRows() { return m_totalSaveRows; }
+        uint32 GetLastSaveStatements() const { return m_saveStatements; }
+        uint32 GetLastSaveRows() const { return m_saveRows; }
+        // autosave ordering weight, changed items and mails
+        uint32 GetUnsavedChangesCount() const { return m_itemUpdateQueue.size() + (m_mailsUpdated ? 1 : 0); }
         static void SetUInt32ValueInArray(Tokens& data,uint16 index, uint32 value);
         static void SetFloatValueInArray(Tokens& data,uint16 index, float value);
         static void Customize(uint64 guid, uint8 gender, uint8 skin, uint8 face, uint8 hairStyle, uint8 hairColor, uint8 facialHair);
@@ -2468,6 +2518,11 @@ class MANGOS_DLL_SPEC Player : public Unit
         void _SaveTalents();
         void _SaveStats();
 
+        // execute statement of character save, counted for save statistics
+        // rows: amount of rows written by multi-row statement, formatted statements write single row
+        void ExecuteSave(std::string const& sql, uint32 rows = 1);
+        void PExecuteSave(const char* format, ...) ATTR_PRINTF(2,3);
+
         void _SetCreateBits(UpdateMask *updateMask, Player *target) const;
         void _SetUpdateBits(UpdateMask *updateMask, Player *target) const;
 
@@ -2490,6 +2545,16 @@ class MANGOS_DLL_SPEC Player : public Unit
 
         uint32 m_team;
         uint32 m_nextSave;
+        uint32 m_savedSections;                             // PlayerSavedSections
+        uint32 m_saveStatements;                            // executed in current save
+        uint32 m_saveRows;                                  // written in current save
+        SavedAuraMap m_savedAuras;
+        SpellCooldowns m_savedCooldowns;
+        std::string m_savedBGData;                          // values of last saved `character_battleground_data` row
+        std::string m_savedStats;                           // values of last saved `character_stats` row
+        static uint32 m_totalSaves;
+        static uint64 m_totalSaveStatements;
+        static uint64 m_totalSaveRows;
         time_t m_speakTime;
         uint32 m_speakCount;
         Difficulty m_dungeonDifficulty;
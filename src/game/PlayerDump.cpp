@@ -202,6 +202,21 @@ bool changetokGuid(std::string &str, int n, std::map<uint32, uint32> &guidMap, u
     return changetoknth(str, n, chritem, false, nonzero);
 }
 
+// item_instance.data in old text or compact form, result always in compact form
+bool changeItemDataGuids(std::string &str, std::map<uint32, uint32> &guidMap, uint32 hiGuid, uint32 ownerGuid)
+{
+    uint32 values[CONTAINER_END];                           // bag or item
+    uint32 count = UInt32ArrayFromString(str.c_str(), values, CONTAINER_END);
+    if (count <= ITEM_FIELD_OWNER || count > CONTAINER_END)
+        return false;
+
+    values[OBJECT_FIELD_GUID] = registerNewGuid(values[OBJECT_FIELD_GUID], guidMap, hiGuid);
+    values[ITEM_FIELD_OWNER] = ownerGuid;
+
+    str = UInt32ArrayToString(values, count);
+    return true;
+}
+
 std::string CreateDumpString(char const* tableName, QueryResult *result)
 {
     if (!tableName || !result)
@@ -269,8 +284,9 @@ void StoreGUID(QueryResult *result,uint32 field,std::set<uint32>& guids)
 void StoreGUID(QueryResult *result,uint32 data,uint32 field, std::set<uint32>& guids)
 {
     Field* fields = result->Fetch();
-    std::string dataStr = fields[data].GetCppString();
-    uint32 guid = atoi(gettoknth(dataStr, field).c_str());
+    uint32 values[CONTAINER_END];
+    uint32 count = UInt32ArrayFromString(fields[data].GetString(), values, CONTAINER_END);
+    uint32 guid = field > 0 && field <= count && field <= CONTAINER_END ? values[field - 1] : 0;
     if (guid)
         guids.insert(guid);
 }
@@ -594,10 +610,8 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
                 if (!changenth(line, 2, newguid))           // item_instance.owner_guid update
                     ROLLBACK(DUMP_FILE_BROKEN);
                 std::string vals = getnth(line,3);          // item_instance.data get
-                if (!changetokGuid(vals, OBJECT_FIELD_GUID+1, items, sObjectMgr.m_ItemGuids.GetNextAfterMaxUsed()))
-                    ROLLBACK(DUMP_FILE_BROKEN);             // item_instance.data.OBJECT_FIELD_GUID update
-                if (!changetoknth(vals, ITEM_FIELD_OWNER+1, newguid))
-                    ROLLBACK(DUMP_FILE_BROKEN);             // item_instance.data.ITEM_FIELD_OWNER update
+                if (!changeItemDataGuids(vals, items, sObjectMgr.m_ItemGuids.GetNextAfterMaxUsed(), guid))
+                    ROLLBACK(DUMP_FILE_BROKEN);             // item_instance.data.OBJECT_FIELD_GUID and ITEM_FIELD_OWNER update
                 if (!changenth(line, 3, vals.c_str()))      // item_instance.data update
                     ROLLBACK(DUMP_FILE_BROKEN);
                 break;
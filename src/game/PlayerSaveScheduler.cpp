@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "PlayerSaveScheduler.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "World.h"
+#include "Log.h"
+#include "Timer.h"
+#include "Policies/SingletonImp.h"
+
+INSTANTIATE_SINGLETON_1( PlayerSaveScheduler );
+
+void PlayerSaveScheduler::AddPlayer(Player* player)
+{
+    if (!m_queued.insert(player->GetObjectGuid()).second)
+        return;
+
+    SaveRequest request;
+    request.guid = player->GetObjectGuid();
+    request.queueTime = getMSTime();
+    request.weight = 0;
+    m_requests.push_back(request);
+}
+
+void PlayerSaveScheduler::Update()
+{
+    if (m_requests.empty())
+        return;
+
+    uint32 now = getMSTime();
+    uint32 maxSaves = sWorld.getConfig(CONFIG_UINT32_SAVE_MAX_PER_TICK);
+    uint32 maxStatements = sWorld.getConfig(CONFIG_UINT32_SAVE_MAX_STATEMENTS_PER_TICK);
+
+    // order only matters if not all requests can be done in this tick
+    if ((maxSaves && m_requests.size() > maxSaves) || maxStatements)
+    {
+        for (SaveRequests::iterator itr = m_requests.begin(); itr != m_requests.end(); ++itr)
+        {
+            Player* player = ObjectAccessor::FindPlayer(itr->guid);
+            itr->weight = (player ? player->GetUnsavedChangesCount() : 0) + getMSTimeDiff(itr->queueTime, now) / IN_MILLISECONDS;
+        }
+
+        std::stable_sort(m_requests.begin(), m_requests.end(), SaveRequestOrder());
+    }
+
+    uint32 saves = 0;
+    uint32 statements = 0;
+    SaveRequests::iterator itr = m_requests.begin();
+    for (; itr != m_requests.end(); ++itr)
+    {
+        if ((maxSaves && saves >= maxSaves) || (maxStatements && statements >= maxStatements))
+            break;
+
+        m_queued.erase(itr->guid);
+
+        // logged out (saved at logout) or out of world at far teleport
+        Player* player = ObjectAccessor::FindPlayer(itr->guid);
+        if (!player)
+            continue;
+
+        player->SaveToDB();
+        DETAIL_LOG("Player '%s' (GUID: %u) saved", player->GetName(), player->GetGUIDLow());
+
+        ++saves;
+        statements += player->GetLastSaveStatements();
+
+        ++m_stats.saves;
+        m_stats.sumWait += getMSTimeDiff(itr->queueTime, now);
+    }
+
+    if (itr != m_requests.end())
+        ++m_stats.limitedTicks;
+
+    m_requests.erase(m_requests.begin(), itr);
+}
+
+PlayerSaveSchedulerStats PlayerSaveScheduler::GetStats() const
+{
+    PlayerSaveSchedulerStats stats = m_stats;
+    stats.backlog = m_requests.size();
+
+    uint32 now = getMSTime();
+    for (SaveRequests::const_iterator itr = m_requests.begin(); itr != m_requests.end(); ++itr)
+        stats.oldestWait = std::max(stats.oldestWait, getMSTimeDiff(itr->queueTime, now));
+
+    return stats;
+}
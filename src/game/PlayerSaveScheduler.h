@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _PLAYER_SAVE_SCHEDULER_H
+#define _PLAYER_SAVE_SCHEDULER_H
+
+#include "Common.h"
+#include "ObjectGuid.h"
+#include "Policies/Singleton.h"
+
+class Player;
+
+struct PlayerSaveSchedulerStats
+{
+    PlayerSaveSchedulerStats() : backlog(0), oldestWait(0), saves(0), limitedTicks(0), sumWait(0) {}
+
+    uint32 backlog;                                         // players waiting autosave
+    uint32 oldestWait;                                      // ms
+    uint64 saves;
+    uint32 limitedTicks;                                    // world ticks with postponed autosaves
+    uint64 sumWait;
+};
+
+/**
+ * Player autosaves admitted by global per tick limits of saves and executed save statements
+ * instead of saving at player own timer expire, so save waves after restart or mass login spread
+ * to flat DB load. Players with most unsaved changes saved first, each waiting second adds to weight
+ * so every player saved in end. Player timer restarted at request, so request lost at far teleport
+ * only delay autosave to next interval.
+ */
+class PlayerSaveScheduler
+{
+    public:
+        PlayerSaveScheduler() {}
+
+        void AddPlayer(Player* player);
+        void Update();
+
+        PlayerSaveSchedulerStats GetStats() const;
+
+    private:
+        struct SaveRequest
+        {
+            ObjectGuid guid;
+            uint32 queueTime;
+            uint32 weight;                                  // set at Update
+        };
+
+        struct SaveRequestOrder
+        {
+            bool operator()(SaveRequest const& a, SaveRequest const& b) const { return a.weight > b.weight; }
+        };
+
+        typedef std::vector<SaveRequest> SaveRequests;
+        typedef std::set<ObjectGuid> QueuedGuids;
+
+        SaveRequests m_requests;
+        QueuedGuids m_queued;                               // prevent repeated requests at long backlog
+
+        PlayerSaveSchedulerStats m_stats;
+};
+
+#define sPlayerSaveScheduler MaNGOS::Singleton<PlayerSaveScheduler>::Instance()
+
+#endif
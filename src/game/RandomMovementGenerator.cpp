@@ -90,6 +90,10 @@ RandomMovementGenerator<Creature>::_setRandomLocation(Creature &creature)
         }
     }
 
+    // walk around obstacles to selected point if navigation data available
+    if (!is_air_ok && i_pathFinder.Calculate(creature, nx, ny, nz))
+        i_pathFinder.GetNextPoint(nx, ny, nz);
+
     Traveller<Creature> traveller(creature);
 
     creature.SetOrientation(creature.GetAngle(nx, ny));
@@ -167,6 +171,17 @@ bool RandomMovementGenerator<Creature>::Update(Creature &creature, const uint32
         if (!IsActive(creature))                        // force stop processing (movement can move out active zone with cleanup movegens list)
             return true;                                // not expire now, but already lost
 
+        // reached intermediate path point, continue to next one
+        if (i_destinationHolder.HasArrived() && i_pathFinder.HasNextPoint())
+        {
+            float x, y, z;
+            i_pathFinder.GetNextPoint(x, y, z);
+            creature.SetOrientation(creature.GetAngle(x, y));
+            i_destinationHolder.SetDestination(traveller, x, y, z);
+            i_nextMoveTime.Reset(urand(500+i_destinationHolder.GetTotalTravelTime(), 10000+i_destinationHolder.GetTotalTravelTime()));
+            return true;
+        }
+
         if (i_nextMoveTime.Passed())
         {
             if (creature.canFly())
@@ -22,6 +22,7 @@
 #include "MovementGenerator.h"
 #include "DestinationHolder.h"
 #include "Traveller.h"
+#include "MoveMap.h"
 
 template<class T>
 class MANGOS_DLL_SPEC RandomMovementGenerator
@@ -47,6 +48,7 @@ class MANGOS_DLL_SPEC RandomMovementGenerator
         TimeTrackerSmall i_nextMoveTime;
 
         DestinationHolder< Traveller<T> > i_destinationHolder;
+        PathFinder i_pathFinder;
         uint32 i_nextMove;
 };
 
@@ -1056,7 +1056,10 @@ void Spell::DoAllEffectOnTarget(TargetInfo *target)
         if (m_spellInfo->SpellFamilyName == SPELLFAMILY_WARLOCK && m_spellInfo->SpellIconID == 3172 &&
             (m_spellInfo->SpellFamilyFlags & UI64LIT(0x0004000000000000)))
             if(Aura* dummy = unitTarget->GetDummyAura(m_spellInfo->Id))
+            {
                 dummy->GetModifier()->m_amount = damageInfo.damage;
+                unitTarget->InvalidateAuraModifierTotals();
+            }
 
         caster->DealSpellDamage(&damageInfo, true);
 
@@ -1446,6 +1449,40 @@ struct TargetDistanceOrder : public std::binary_function<const Unit, const Unit,
     }
 };
 
+// Helper for chain jumps: each next target is nearest in jump radius of previous and in its LOS
+// Only few candidates in jump radius, so sorting them at each jump cheaper than resort all candidates
+static void FillChainTargets(std::list<Unit*>& targetUnitMap, std::list<Unit*>& candidates, Unit* prev, uint32 count)
+{
+    std::vector<Unit*> inJumpRange;
+    while (count && !candidates.empty())
+    {
+        inJumpRange.clear();
+        for (std::list<Unit*>::const_iterator itr = candidates.begin(); itr != candidates.end(); ++itr)
+            if (prev->IsWithinDist(*itr, CHAIN_SPELL_JUMP_RADIUS))
+                inJumpRange.push_back(*itr);
+
+        std::stable_sort(inJumpRange.begin(), inJumpRange.end(), TargetDistanceOrder(prev));
+
+        Unit* next = NULL;
+        for (std::vector<Unit*>::const_iterator itr = inJumpRange.begin(); itr != inJumpRange.end(); ++itr)
+        {
+            if (prev->IsWithinLOSInMap(*itr))
+            {
+                next = *itr;
+                break;
+            }
+        }
+
+        if (!next)
+            break;
+
+        candidates.remove(next);
+        targetUnitMap.push_back(next);
+        prev = next;
+        --count;
+    }
+}
+
 void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList& targetUnitMap)
 {
     float radius;
@@ -1618,31 +1655,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
 
             tempTargetUnitMap.erase(itr);
 
-            tempTargetUnitMap.sort(TargetDistanceOrder(pUnitTarget));
-
-            t = unMaxTargets - 1;
-            Unit *prev = pUnitTarget;
-            std::list<Unit*>::iterator next = tempTargetUnitMap.begin();
-
-            while(t && next != tempTargetUnitMap.end())
-            {
-                if(!prev->IsWithinDist(*next, CHAIN_SPELL_JUMP_RADIUS))
-                    break;
-
-                if(!prev->IsWithinLOSInMap(*next))
-                {
-                    ++next;
-                    continue;
-                }
-
-                prev = *next;
-                targetUnitMap.push_back(prev);
-                tempTargetUnitMap.erase(next);
-                tempTargetUnitMap.sort(TargetDistanceOrder(prev));
-                next = tempTargetUnitMap.begin();
-
-                --t;
-            }
+            FillChainTargets(targetUnitMap, tempTargetUnitMap, pUnitTarget, unMaxTargets - 1);
             break;
         }
         case TARGET_RANDOM_FRIEND_CHAIN_IN_AREA:
@@ -1678,29 +1691,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
 
             tempTargetUnitMap.erase(itr);
 
-            tempTargetUnitMap.sort(TargetDistanceOrder(pUnitTarget));
-
-            t = unMaxTargets - 1;
-            Unit *prev = pUnitTarget;
-            std::list<Unit*>::iterator next = tempTargetUnitMap.begin();
-
-            while(t && next != tempTargetUnitMap.end())
-            {
-                if(!prev->IsWithinDist(*next, CHAIN_SPELL_JUMP_RADIUS))
-                    break;
-
-                if(!prev->IsWithinLOSInMap(*next))
-                {
-                    ++next;
-                    continue;
-                }
-                prev = *next;
-                targetUnitMap.push_back(prev);
-                tempTargetUnitMap.erase(next);
-                tempTargetUnitMap.sort(TargetDistanceOrder(prev));
-                next = tempTargetUnitMap.begin();
-                --t;
-            }
+            FillChainTargets(targetUnitMap, tempTargetUnitMap, pUnitTarget, unMaxTargets - 1);
             break;
         }
         case TARGET_PET:
@@ -1745,32 +1736,10 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                 if (tempTargetUnitMap.empty())
                     break;
 
-                tempTargetUnitMap.sort(TargetDistanceOrder(pUnitTarget));
-
-                if (*tempTargetUnitMap.begin() == pUnitTarget)
-                    tempTargetUnitMap.erase(tempTargetUnitMap.begin());
+                tempTargetUnitMap.remove(pUnitTarget);
 
                 targetUnitMap.push_back(pUnitTarget);
-                uint32 t = unMaxTargets - 1;
-                Unit *prev = pUnitTarget;
-                std::list<Unit*>::iterator next = tempTargetUnitMap.begin();
-
-                while (t && next != tempTargetUnitMap.end())
-                {
-                    if (!prev->IsWithinDist (*next,CHAIN_SPELL_JUMP_RADIUS))
-                        break;
-                    if (!prev->IsWithinLOSInMap (*next))
-                    {
-                        ++next;
-                        continue;
-                    }
-                    prev = *next;
-                    targetUnitMap.push_back(prev);
-                    tempTargetUnitMap.erase(next);
-                    tempTargetUnitMap.sort(TargetDistanceOrder(prev));
-                    next = tempTargetUnitMap.begin();
-                    --t;
-                }
+                FillChainTargets(targetUnitMap, tempTargetUnitMap, pUnitTarget, unMaxTargets - 1);
             }
             break;
         }
@@ -697,6 +697,10 @@ namespace MaNGOS
 
             for(typename GridRefManager<T>::iterator itr = m.begin(); itr != m.end(); ++itr)
             {
+                // area check first, it cheap and fail for most units of visited cells
+                if (!IsInArea(itr->getSource()))
+                    continue;
+
                 // there are still more spells which can be casted on dead, but
                 // they are no AOE and don't have such a nice SPELL_ATTR flag
                 if ( (i_TargetType != SPELL_TARGETS_ALL && !itr->getSource()->isTargetableForAttack(i_spell.m_spellInfo->AttributesEx3 & SPELL_ATTR_EX3_CAST_ON_DEAD))
@@ -744,45 +748,35 @@ namespace MaNGOS
                     default: continue;
                 }
 
-                // we don't need to check InMap here, it's already done some lines above
-                switch(i_push_type)
-                {
-                    case PUSH_IN_FRONT:
-                        if(i_spell.GetCaster()->isInFront((Unit*)(itr->getSource()), i_radius, 2*M_PI_F/3 ))
-                            i_data->push_back(itr->getSource());
-                        break;
-                    case PUSH_IN_FRONT_90:
-                        if(i_spell.GetCaster()->isInFront((Unit*)(itr->getSource()), i_radius, M_PI_F/2 ))
-                            i_data->push_back(itr->getSource());
-                        break;
-                    case PUSH_IN_FRONT_30:
-                        if(i_spell.GetCaster()->isInFront((Unit*)(itr->getSource()), i_radius, M_PI_F/6 ))
-                            i_data->push_back(itr->getSource());
-                        break;
-                    case PUSH_IN_FRONT_15:
-                        if(i_spell.GetCaster()->isInFront((Unit*)(itr->getSource()), i_radius, M_PI_F/12 ))
-                            i_data->push_back(itr->getSource());
-                        break;
-                    case PUSH_IN_BACK:
-                        if(i_spell.GetCaster()->isInBack((Unit*)(itr->getSource()), i_radius, 2*M_PI_F/3 ))
-                            i_data->push_back(itr->getSource());
-                        break;
-                    case PUSH_SELF_CENTER:
-                        if(i_spell.GetCaster()->IsWithinDist((Unit*)(itr->getSource()), i_radius))
-                            i_data->push_back(itr->getSource());
-                        break;
-                    case PUSH_DEST_CENTER:
-                        if(itr->getSource()->IsWithinDist3d(i_spell.m_targets.m_destX, i_spell.m_targets.m_destY, i_spell.m_targets.m_destZ,i_radius))
-                            i_data->push_back(itr->getSource());
-                        break;
-                    case PUSH_TARGET_CENTER:
-                        if(i_spell.m_targets.getUnitTarget()->IsWithinDist((Unit*)(itr->getSource()), i_radius))
-                            i_data->push_back(itr->getSource());
-                        break;
-                }
+                i_data->push_back(itr->getSource());
             }
         }
 
+        // we don't need to check InMap here, it's done by caller after this check
+        bool IsInArea(Unit* target) const
+        {
+            switch(i_push_type)
+            {
+                case PUSH_IN_FRONT:
+                    return i_spell.GetCaster()->isInFront(target, i_radius, 2*M_PI_F/3 );
+                case PUSH_IN_FRONT_90:
+                    return i_spell.GetCaster()->isInFront(target, i_radius, M_PI_F/2 );
+                case PUSH_IN_FRONT_30:
+                    return i_spell.GetCaster()->isInFront(target, i_radius, M_PI_F/6 );
+                case PUSH_IN_FRONT_15:
+                    return i_spell.GetCaster()->isInFront(target, i_radius, M_PI_F/12 );
+                case PUSH_IN_BACK:
+                    return i_spell.GetCaster()->isInBack(target, i_radius, 2*M_PI_F/3 );
+                case PUSH_SELF_CENTER:
+                    return i_spell.GetCaster()->IsWithinDist(target, i_radius);
+                case PUSH_DEST_CENTER:
+                    return target->IsWithinDist3d(i_spell.m_targets.m_destX, i_spell.m_targets.m_destY, i_spell.m_targets.m_destZ,i_radius);
+                case PUSH_TARGET_CENTER:
+                    return i_spell.m_targets.getUnitTarget()->IsWithinDist(target, i_radius);
+            }
+            return false;
+        }
+
         #ifdef WIN32
         template<> inline void Visit(CorpseMapType & ) {}
         template<> inline void Visit(GameObjectMapType & ) {}
@@ -888,12 +888,17 @@ void Aura::ApplyModifier(bool apply, bool Real)
 {
     AuraType aura = m_modifier.m_auraname;
 
+    // handlers can change own or other target auras amount before and after use it
+    GetTarget()->InvalidateAuraModifierTotals();
+
     GetHolder()->SetInUse(true);
     SetInUse(true);
     if(aura < TOTAL_AURAS)
         (*this.*AuraHandler [aura])(apply, Real);
     SetInUse(false);
     GetHolder()->SetInUse(false);
+
+    GetTarget()->InvalidateAuraModifierTotals();
 }
 
 bool Aura::isAffectedOnSpell(SpellEntry const *spell) const
@@ -1675,6 +1680,7 @@ void Aura::TriggerSpell()
                         if (((Player*)triggerTarget)->isMoving())
                         {
                             m_modifier.m_amount = 6;
+                            GetTarget()->InvalidateAuraModifierTotals();
                             return;
                         }
 
@@ -7229,6 +7235,7 @@ void Aura::PeriodicDummyTick()
                 if (Aura* aura = GetHolder()->GetAuraByEffectIndex(SpellEffectIndex(GetEffIndex() - 1)))
                 {
                     aura->GetModifier()->m_amount = m_modifier.m_amount;
+                    target->InvalidateAuraModifierTotals();
                     ((Player*)target)->UpdateManaRegen();
                     // Disable continue
                     m_isPeriodic = false;
@@ -7755,6 +7762,11 @@ m_auraFlags(AFLAG_NONE), m_auraLevel(1), m_procCharges(0), m_stackAmount(1)
     if(GetSpellMaxDuration(m_spellProto) == -1 || m_isPassive && m_spellProto->DurationIndex == 0)
         m_permanent = true;
 
+    // custom proc flags replace spell proc flags, fixed for holder lifetime for keep Unit::m_procAuraHolders consistent
+    // so reloaded spell_proc_event can add proc flags only for holders applied after reload
+    SpellProcEventEntry const* spellProcEvent = sSpellMgr.GetSpellProcEvent(GetId());
+    m_procFlags = spellProcEvent && spellProcEvent->procFlags ? spellProcEvent->procFlags : m_spellProto->procFlags;
+
     m_isRemovedOnShapeLost = (m_caster_guid==m_target->GetGUID() &&
                               m_spellProto->Stances &&
                             !(m_spellProto->AttributesEx2 & SPELL_ATTR_EX2_NOT_NEED_SHAPESHIFT) &&
@@ -8837,6 +8849,29 @@ void SpellAuraHolder::Update(uint32 diff)
     }
 }
 
+bool SpellAuraHolder::IsUpdateNeeded() const
+{
+    if (IsChanneledSpell(m_spellProto))
+        return true;
+
+    for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
+        if (Aura *aura = m_auras[i])
+            if (aura->GetAuraDuration() > 0 || aura->IsPeriodic() || aura->IsAreaAura() || aura->IsPersistent())
+                return true;
+
+    return false;
+}
+
+bool SpellAuraHolder::HasExpiredAura() const
+{
+    for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
+        if (Aura *aura = m_auras[i])
+            if (!aura->GetAuraDuration())
+                return true;
+
+    return false;
+}
+
 void SpellAuraHolder::RefreshHolder()
 {
     for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
@@ -78,6 +78,7 @@ class MANGOS_DLL_SPEC SpellAuraHolder
 		void SetPermanent (bool permanent) { m_permanent = permanent; }
         bool IsPassive() const { return m_isPassive; }
         bool IsDeathPersistent() const { return m_isDeathPersist; }
+        uint32 GetProcFlags() const { return m_procFlags; }
         bool IsPersistent() const;
         bool IsPositive() const;
         bool IsWeaponBuffCoexistableWith(SpellAuraHolder* ref);
@@ -102,6 +103,8 @@ class MANGOS_DLL_SPEC SpellAuraHolder
 
         void UpdateHolder(uint32 diff) { SetInUse(true); Update(diff); SetInUse(false); }
         void Update(uint32 diff);
+        bool IsUpdateNeeded() const;                        // false if no auras with timers or target checks
+        bool HasExpiredAura() const;
         void RefreshHolder();
         
         bool IsSingleTarget() {return m_isSingleTarget; }
@@ -168,6 +171,8 @@ class MANGOS_DLL_SPEC SpellAuraHolder
         uint8 m_procCharges;                                // Aura charges (0 for infinite)
         uint8 m_stackAmount;                                // Aura stack amount
 
+        uint32 m_procFlags;                                 // from spell_proc_event or spell at creation, 0 if can't proc
+
         AuraRemoveMode m_removeMode:8;                      // Store info for know remove aura reason
         DiminishingGroup m_AuraDRGroup:8;                   // Diminishing
 
@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "StartupLoader.h"
+#include "Database/DatabaseEnv.h"
+#include "Log.h"
+#include "ProgressBar.h"
+#include "Threading.h"
+#include "Timer.h"
+#include "Errors.h"
+
+#include <sstream>
+#include <algorithm>
+
+#if PLATFORM != PLATFORM_WINDOWS
+#include <unistd.h>
+#endif
+
+// resident memory size of process, -1 if not available at platform
+static int64 GetProcessMemoryUsage()
+{
+#if defined(__linux__)
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if (!statm)
+        return -1;
+
+    long size = 0;
+    long resident = 0;
+    int res = fscanf(statm, "%ld %ld", &size, &resident);
+    fclose(statm);
+
+    return res == 2 ? int64(resident) * sysconf(_SC_PAGESIZE) : -1;
+#else
+    return -1;
+#endif
+}
+
+class StartupLoaderWorker : public ACE_Based::Runnable
+{
+    public:
+        explicit StartupLoaderWorker(StartupLoader& loader) : i_loader(loader) {}
+
+        void run()
+        {
+            WorldDatabase.ThreadStart();                    // let thread safe use all databases
+            i_loader.WorkerLoop();
+            WorldDatabase.ThreadEnd();
+        }
+
+    private:
+        StartupLoader& i_loader;
+};
+
+struct TaskTimeOrder
+{
+    bool operator()(std::pair<uint32, uint32> const& a, std::pair<uint32, uint32> const& b) const
+    {
+        return a.first > b.first;
+    }
+};
+
+StartupLoader::~StartupLoader()
+{
+    for (TaskList::iterator itr = i_tasks.begin(); itr != i_tasks.end(); ++itr)
+        delete itr->task;
+}
+
+void StartupLoader::AddTask(char const* name, char const* title, StartupLoaderTask* task, char const* depends)
+{
+    TaskInfo info;
+    info.name = name;
+    info.title = title;
+    info.task = task;
+    info.waitCount = 0;
+    info.state = TASK_WAITING;
+    info.time = 0;
+    info.memory = 0;
+
+    if (depends)
+    {
+        std::istringstream ss(depends);
+        std::string depName;
+        while (ss >> depName)
+        {
+            uint32 idx = 0;
+            for (; idx < i_tasks.size(); ++idx)
+                if (i_tasks[idx].name == depName)
+                    break;
+
+            if (idx == i_tasks.size())
+            {
+                sLog.outError("StartupLoader: task '%s' depends on unknown or later added task '%s'", name, depName.c_str());
+                ASSERT(false);
+            }
+
+            info.depends.push_back(idx);
+            ++info.waitCount;
+        }
+    }
+
+    i_tasks.push_back(info);
+}
+
+bool StartupLoader::Run(uint32 threads)
+{
+    uint32 startTime = getMSTime();
+
+    if (threads <= 1)
+    {
+        // addition order is valid dependency order
+        for (TaskList::iterator itr = i_tasks.begin(); itr != i_tasks.end() && !i_failed; ++itr)
+        {
+            itr->state = TASK_RUNNING;
+            if (!RunTask(*itr))
+                i_failed = true;
+            itr->state = TASK_DONE;
+        }
+    }
+    else
+    {
+        // progress bars of concurrent tasks can't share console line
+        barGoLink::SetOutputState(false);
+
+        std::vector<ACE_Based::Thread*> workers;
+        for (uint32 i = 0; i < threads; ++i)
+            workers.push_back(new ACE_Based::Thread(new StartupLoaderWorker(*this)));
+
+        for (std::vector<ACE_Based::Thread*>::iterator itr = workers.begin(); itr != workers.end(); ++itr)
+        {
+            (*itr)->wait();
+            delete *itr;
+        }
+
+        barGoLink::SetOutputState(true);
+    }
+
+    if (!i_failed)
+        ReportStatistics(threads, getMSTimeDiff(startTime, getMSTime()));
+
+    return !i_failed;
+}
+
+bool StartupLoader::RunTask(TaskInfo& info)
+{
+    sLog.outString("%s", info.title.c_str());
+
+    int64 memoryBefore = GetProcessMemoryUsage();
+    uint32 startTime = getMSTime();
+
+    bool result = info.task->Run();
+
+    info.time = getMSTimeDiff(startTime, getMSTime());
+    int64 memoryAfter = GetProcessMemoryUsage();
+    info.memory = memoryBefore >= 0 && memoryAfter >= 0 ? memoryAfter - memoryBefore : 0;
+
+    if (!result)
+        sLog.outError("Loading step '%s' failed, server start canceled.", info.name.c_str());
+
+    return result;
+}
+
+void StartupLoader::WorkerLoop()
+{
+    i_lock.acquire();
+
+    for (;;)
+    {
+        // first ready task in addition order, it is also usually the most depended on
+        TaskInfo* next = NULL;
+        bool haveWaiting = false;
+        if (!i_failed)
+        {
+            for (TaskList::iterator itr = i_tasks.begin(); itr != i_tasks.end(); ++itr)
+            {
+                if (itr->state != TASK_WAITING)
+                    continue;
+
+                haveWaiting = true;
+                if (itr->waitCount == 0)
+                {
+                    next = &*itr;
+                    break;
+                }
+            }
+        }
+
+        if (!next)
+        {
+            // all tasks started or loading canceled
+            if (!haveWaiting)
+                break;
+
+            i_wakeUp.wait();
+            continue;
+        }
+
+        next->state = TASK_RUNNING;
+
+        i_lock.release();
+        bool result = RunTask(*next);
+        i_lock.acquire();
+
+        next->state = TASK_DONE;
+        if (!result)
+            i_failed = true;
+
+        uint32 doneIdx = next - &i_tasks[0];
+        for (TaskList::iterator itr = i_tasks.begin(); itr != i_tasks.end(); ++itr)
+            for (std::vector<uint32>::const_iterator dep = itr->depends.begin(); dep != itr->depends.end(); ++dep)
+                if (*dep == doneIdx)
+                    --itr->waitCount;
+
+        i_wakeUp.broadcast();
+    }
+
+    i_lock.release();
+}
+
+void StartupLoader::ReportStatistics(uint32 threads, uint32 totalTime) const
+{
+    // process memory change is step memory only if steps not run at same time
+    bool haveMemory = threads <= 1 && GetProcessMemoryUsage() >= 0;
+
+    // longest chain of dependent tasks, lower bound of loading time for any threads amount
+    std::vector<uint32> pathTime(i_tasks.size(), 0);
+    std::vector<int32> pathPrev(i_tasks.size(), -1);
+    uint32 sumTime = 0;
+    uint32 pathEnd = 0;
+    for (uint32 i = 0; i < i_tasks.size(); ++i)
+    {
+        for (std::vector<uint32>::const_iterator dep = i_tasks[i].depends.begin(); dep != i_tasks[i].depends.end(); ++dep)
+        {
+            if (pathTime[*dep] > pathTime[i])
+            {
+                pathTime[i] = pathTime[*dep];
+                pathPrev[i] = *dep;
+            }
+        }
+        pathTime[i] += i_tasks[i].time;
+        sumTime += i_tasks[i].time;
+
+        if (pathTime[i] > pathTime[pathEnd])
+            pathEnd = i;
+    }
+
+    sLog.outString();
+    sLog.outString(">> Loaded %u startup data steps in %u ms by %u thread(s), sum of step times %u ms",
+        uint32(i_tasks.size()), totalTime, threads > 1 ? threads : 1, sumTime);
+
+    if (i_tasks.empty())
+        return;
+
+    std::string path;
+    for (int32 i = pathEnd; i >= 0; i = pathPrev[i])
+        path = path.empty() ? i_tasks[i].name : i_tasks[i].name + " -> " + path;
+    sLog.outString(">> Critical path %u ms: %s", pathTime[pathEnd], path.c_str());
+
+    std::vector<std::pair<uint32, uint32> > byTime;
+    for (uint32 i = 0; i < i_tasks.size(); ++i)
+        byTime.push_back(std::pair<uint32, uint32>(i_tasks[i].time, i));
+    std::stable_sort(byTime.begin(), byTime.end(), TaskTimeOrder());
+
+    // slowest steps always, all steps in detailed log
+    for (uint32 i = 0; i < byTime.size(); ++i)
+    {
+        TaskInfo const& info = i_tasks[byTime[i].second];
+        if (haveMemory)
+        {
+            if (i < 10)
+                sLog.outString("   %-32s %8u ms %10d KB", info.name.c_str(), info.time, int32(info.memory / 1024));
+            else
+                sLog.outDetail("   %-32s %8u ms %10d KB", info.name.c_str(), info.time, int32(info.memory / 1024));
+        }
+        else
+        {
+            if (i < 10)
+                sLog.outString("   %-32s %8u ms", info.name.c_str(), info.time);
+            else
+                sLog.outDetail("   %-32s %8u ms", info.name.c_str(), info.time);
+        }
+    }
+    sLog.outString();
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2005-2010 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_STARTUPLOADER_H
+#define MANGOS_STARTUPLOADER_H
+
+#include "Common.h"
+
+#include <ace/Thread_Mutex.h>
+#include <ace/Condition_Thread_Mutex.h>
+
+class StartupLoaderWorker;
+
+/// One loading step, return false if server start must be canceled
+class StartupLoaderTask
+{
+    public:
+        virtual ~StartupLoaderTask() {}
+        virtual bool Run() = 0;
+};
+
+template<class T>
+class StartupLoaderMethod : public StartupLoaderTask
+{
+    public:
+        typedef void (T::*Method)();
+
+        StartupLoaderMethod(T& obj, Method method) : i_obj(obj), i_method(method) {}
+        bool Run() { (i_obj.*i_method)(); return true; }
+
+    private:
+        T& i_obj;
+        Method i_method;
+};
+
+class StartupLoaderFunction : public StartupLoaderTask
+{
+    public:
+        typedef void (*Function)();
+
+        explicit StartupLoaderFunction(Function func) : i_func(func) {}
+        bool Run() { i_func(); return true; }
+
+    private:
+        Function i_func;
+};
+
+class StartupLoaderCheckedFunction : public StartupLoaderTask
+{
+    public:
+        typedef bool (*Function)();
+
+        explicit StartupLoaderCheckedFunction(Function func) : i_func(func) {}
+        bool Run() { return i_func(); }
+
+    private:
+        Function i_func;
+};
+
+/**
+ * Startup data loading by dependency graph. Each task lists names of tasks it needs loaded before it,
+ * dependencies must be added earlier so addition order is always valid sequential order.
+ * With more than one thread independent tasks are executed concurrently, a failed task stops
+ * starting of new tasks. After loading time and memory usage of tasks and the critical path are reported.
+ */
+class StartupLoader
+{
+    friend class StartupLoaderWorker;
+
+    public:
+        StartupLoader() : i_wakeUp(i_lock), i_failed(false) {}
+        ~StartupLoader();
+
+        template<class T>
+        void AddTask(char const* name, char const* title, T& obj, void (T::*method)(), char const* depends = NULL)
+        {
+            AddTask(name, title, new StartupLoaderMethod<T>(obj, method), depends);
+        }
+        void AddTask(char const* name, char const* title, StartupLoaderFunction::Function func, char const* depends = NULL)
+        {
+            AddTask(name, title, new StartupLoaderFunction(func), depends);
+        }
+        void AddTask(char const* name, char const* title, StartupLoaderCheckedFunction::Function func, char const* depends = NULL)
+        {
+            AddTask(name, title, new StartupLoaderCheckedFunction(func), depends);
+        }
+        void AddTask(char const* name, char const* title, StartupLoaderTask* task, char const* depends);
+
+        // false if some task failed
+        bool Run(uint32 threads);
+
+    private:
+        enum TaskState
+        {
+            TASK_WAITING,
+            TASK_RUNNING,
+            TASK_DONE
+        };
+
+        struct TaskInfo
+        {
+            std::string name;
+            std::string title;
+            StartupLoaderTask* task;
+            std::vector<uint32> depends;                    // indexes in i_tasks
+            uint32 waitCount;                               // not finished dependencies
+            TaskState state;
+            uint32 time;                                    // ms
+            int64 memory;                                   // process memory change while running, bytes (reported for one thread loading only)
+        };
+
+        typedef std::vector<TaskInfo> TaskList;
+
+        bool RunTask(TaskInfo& info);
+        void WorkerLoop();
+        void ReportStatistics(uint32 threads, uint32 totalTime) const;
+
+        TaskList i_tasks;
+
+        // task states and i_failed guarded by i_lock in threaded mode
+        ACE_Thread_Mutex i_lock;
+        ACE_Condition_Thread_Mutex i_wakeUp;                // signaled at task finish
+        bool i_failed;
+};
+
+#endif
@@ -74,6 +74,11 @@ void TargetedMovementGeneratorMedium<T,D>::_setTargetLocation(T &owner)
         if( i_destinationHolder.HasDestination() && i_destinationHolder.GetDestinationDiff(x,y,z) < bothObjectSize )
             return;
     */
+
+    // go around obstacles by navigation data if available, else straight to target point
+    if (i_pathFinder.Calculate(owner, x, y, z))
+        i_pathFinder.GetNextPoint(x, y, z);
+
     Traveller<T> traveller(owner);
     i_destinationHolder.SetDestination(traveller, x, y, z);
 
@@ -166,11 +171,20 @@ bool TargetedMovementGeneratorMedium<T,D>::Update(T &owner, const uint32 & time_
         //More distance let have better performance, less distance let have more sensitive reaction at target move.
 
         // try to counter precision differences
-        if (i_destinationHolder.GetDistance3dFromDestSq(*i_target.getTarget()) >= dist * dist)
+        if (_getDistanceFromFinalDestSq(*i_target.getTarget()) >= dist * dist)
         {
             owner.SetInFront(i_target.getTarget());         // Set new Angle For Map::
             _setTargetLocation(owner);                      //Calculate New Dest and Send data To Player
         }
+        // reached intermediate path point, continue to next one
+        else if (i_destinationHolder.HasArrived() && i_pathFinder.HasNextPoint())
+        {
+            float x, y, z;
+            i_pathFinder.GetNextPoint(x, y, z);
+            owner.SetInFront(i_target.getTarget());
+            i_destinationHolder.SetDestination(traveller, x, y, z);
+            return true;
+        }
         // Update the Angle of the target only for Map::, no need to send packet for player
         else if (!i_angle && !owner.HasInArc(0.01f, i_target.getTarget()))
             owner.SetInFront(i_target.getTarget());
@@ -188,6 +202,19 @@ bool TargetedMovementGeneratorMedium<T,D>::Update(T &owner, const uint32 & time_
     return true;
 }
 
+template<class T, typename D>
+float TargetedMovementGeneratorMedium<T,D>::_getDistanceFromFinalDestSq(WorldObject const& obj) const
+{
+    float x, y, z;
+    if (!i_pathFinder.GetEndPoint(x, y, z))
+        return i_destinationHolder.GetDistance3dFromDestSq(obj);
+
+    float dx = x - obj.GetPositionX();
+    float dy = y - obj.GetPositionY();
+    float dz = z - obj.GetPositionZ();
+    return dx*dx + dy*dy + dz*dz;
+}
+
 //-----------------------------------------------//
 template<class T>
 void ChaseMovementGenerator<T>::_reachTarget(T &owner)
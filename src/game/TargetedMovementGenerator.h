@@ -23,6 +23,7 @@
 #include "DestinationHolder.h"
 #include "Traveller.h"
 #include "FollowerReference.h"
+#include "MoveMap.h"
 
 class MANGOS_DLL_SPEC TargetedMovementGeneratorBase
 {
@@ -63,10 +64,12 @@ class MANGOS_DLL_SPEC TargetedMovementGeneratorMedium
 
     protected:
         void _setTargetLocation(T &);
+        float _getDistanceFromFinalDestSq(WorldObject const& obj) const;
 
         float i_offset;
         float i_angle;
         DestinationHolder< Traveller<T> > i_destinationHolder;
+        PathFinder i_pathFinder;
         bool i_recalculateTravel;
 };
 
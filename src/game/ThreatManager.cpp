@@ -214,24 +214,31 @@ void ThreatContainer::clearReferences()
         delete (*i);
     }
     iThreatList.clear();
+    iThreatIndex.clear();
+}
+
+//============================================================
+
+void ThreatContainer::remove(HostileReference* pRef)
+{
+    iThreatList.remove(pRef);
+    iThreatIndex.erase(pRef->getUnitGuid());
+}
+
+//============================================================
+
+void ThreatContainer::addReference(HostileReference* pHostileReference)
+{
+    iThreatList.push_back(pHostileReference);
+    iThreatIndex[pHostileReference->getUnitGuid()] = pHostileReference;
 }
 
 //============================================================
 // Return the HostileReference of NULL, if not found
 HostileReference* ThreatContainer::getReferenceByTarget(Unit* pVictim)
 {
-    HostileReference* result = NULL;
-    uint64 guid = pVictim->GetGUID();
-    for(ThreatList::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-    {
-        if((*i)->getUnitGuid() == guid)
-        {
-            result = (*i);
-            break;
-        }
-    }
-
-    return result;
+    ThreatIndex::const_iterator itr = iThreatIndex.find(pVictim->GetGUID());
+    return itr != iThreatIndex.end() ? itr->second : NULL;
 }
 
 //============================================================
@@ -253,22 +260,42 @@ void ThreatContainer::modifyThreatPercent(Unit *pVictim, int32 pPercent)
         ref->addThreatPercent(pPercent);
 }
 
-//============================================================
-
-bool HostileReferenceSortPredicate(const HostileReference* lhs, const HostileReference* rhs)
-{
-    // std::list::sort ordering predicate must be: (Pred(x,y)&&Pred(y,x))==false
-    return lhs->getThreat() > rhs->getThreat();             // reverse sorting
-}
-
 //============================================================
 // Check if the list is dirty and sort if necessary
+// Between updates usually only few references change threat, so list resorted by moving
+// each out of order reference forward to its place (stable, same result as full sort)
 
 void ThreatContainer::update()
 {
     if(iDirty && iThreatList.size() >1)
     {
-        iThreatList.sort(HostileReferenceSortPredicate);
+        ThreatList::iterator itr = iThreatList.begin();
+        for (++itr; itr != iThreatList.end();)
+        {
+            ThreatList::iterator next = itr;
+            ++next;
+
+            ThreatList::iterator pos = itr;
+            --pos;
+
+            float threat = (*itr)->getThreat();
+            if ((*pos)->getThreat() < threat)
+            {
+                // find first from less threat references before current
+                while (pos != iThreatList.begin())
+                {
+                    ThreatList::iterator prev = pos;
+                    --prev;
+                    if ((*prev)->getThreat() >= threat)
+                        break;
+                    pos = prev;
+                }
+
+                iThreatList.splice(pos, iThreatList, itr);
+            }
+
+            itr = next;
+        }
     }
     iDirty = false;
 }
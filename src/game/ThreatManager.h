@@ -24,6 +24,7 @@
 #include "Utilities/LinkedReference/Reference.h"
 #include "UnitEvents.h"
 #include "Timer.h"
+#include "Utilities/UnorderedMap.h"
 #include <list>
 
 //==============================================================
@@ -135,13 +136,16 @@ typedef std::list<HostileReference*> ThreatList;
 class MANGOS_DLL_SPEC ThreatContainer
 {
     private:
+        typedef UNORDERED_MAP<uint64, HostileReference*> ThreatIndex;
+
         ThreatList iThreatList;
+        ThreatIndex iThreatIndex;                           // victim guid -> reference, for search without list walk
         bool iDirty;
     protected:
         friend class ThreatManager;
 
-        void remove(HostileReference* pRef) { iThreatList.remove(pRef); }
-        void addReference(HostileReference* pHostileReference) { iThreatList.push_back(pHostileReference); }
+        void remove(HostileReference* pRef);
+        void addReference(HostileReference* pHostileReference);
         void clearReferences();
         // Sort the list if necessary
         void update();
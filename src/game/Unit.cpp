@@ -242,6 +242,9 @@ Unit::Unit()
     // remove aurastates allowing special moves
     for(int i=0; i < MAX_REACTIVE; ++i)
         m_reactiveTimer[i] = 0;
+
+    m_auraModifierTotals = NULL;
+    m_auraModifierTotalsGeneration = 1;
 }
 
 Unit::~Unit()
@@ -259,6 +262,8 @@ Unit::~Unit()
     if (m_charmInfo)
         delete m_charmInfo;
 
+    delete[] m_auraModifierTotals;
+
     // those should be already removed at "RemoveFromWorld()" call
     ASSERT(m_gameObj.size() == 0);
     ASSERT(m_dynObjGUIDs.size() == 0);
@@ -2125,6 +2130,7 @@ void Unit::CalculateAbsorbAndResist(Unit *pCaster, SpellSchoolMask schoolMask, D
         mod->m_amount-=currentAbsorb;
         if((*i)->GetHolder()->DropAuraCharge())
             mod->m_amount = 0;
+        InvalidateAuraModifierTotals();
         // Need remove it later
         if (mod->m_amount<=0)
             existExpired = true;
@@ -2184,6 +2190,7 @@ void Unit::CalculateAbsorbAndResist(Unit *pCaster, SpellSchoolMask schoolMask, D
             incanterAbsorption += currentAbsorb;
 
         (*i)->GetModifier()->m_amount -= currentAbsorb;
+        InvalidateAuraModifierTotals();
         if((*i)->GetModifier()->m_amount <= 0)
         {
             RemoveAurasDueToSpell((*i)->GetId());
@@ -3302,47 +3309,44 @@ void Unit::_UpdateSpells( uint32 time )
         }
     }
 
-    // update auras
+    // update auras, expired auras collected in same pass and removed after it
     // m_AurasUpdateIterator can be updated in inderect called code at aura remove to skip next planned to update but removed auras
+    std::vector<std::pair<uint32, SpellAuraHolder*> > expiredHolders;
     for (m_spellAuraHoldersUpdateIterator = m_spellAuraHolders.begin(); m_spellAuraHoldersUpdateIterator != m_spellAuraHolders.end();)
     {
         SpellAuraHolder* i_holder = m_spellAuraHoldersUpdateIterator->second;
         ++m_spellAuraHoldersUpdateIterator;                            // need shift to next for allow update if need into aura update
+
+        // passive and permanent auras not expire, most of them also not have any timers
+        if (i_holder->IsPermanent() || i_holder->IsPassive())
+        {
+            if (i_holder->IsUpdateNeeded())
+                i_holder->UpdateHolder(time);
+            continue;
+        }
+
         i_holder->UpdateHolder(time);
+
+        // holder memory kept until CleanupDeletedAuras if it was removed in own update
+        if (!i_holder->IsDeleted() && i_holder->HasExpiredAura())
+            expiredHolders.push_back(std::pair<uint32, SpellAuraHolder*>(i_holder->GetId(), i_holder));
     }
 
     // remove expired auras
-    for (SpellAuraHolderMap::iterator iter = m_spellAuraHolders.begin(); iter != m_spellAuraHolders.end();)
+    for (std::vector<std::pair<uint32, SpellAuraHolder*> >::const_iterator itr = expiredHolders.begin(); itr != expiredHolders.end(); ++itr)
     {
-        SpellAuraHolder *holder = iter->second;
-        if (holder)
+        SpellAuraHolder* holder = itr->second;
+
+        for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
         {
-            if (!(holder->IsPermanent() || holder->IsPassive()) )
-            {
-                bool removedAura = false;
-                for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
-                {
-                    if (Aura *aura = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
-                    {
-                        if (!aura->GetAuraDuration())
-                        {
-                            RemoveSingleAuraFromSpellAuraHolder(holder, aura->GetEffIndex(), AURA_REMOVE_BY_EXPIRE);
-                            removedAura = true;
-                            break;
-                        }
-                    }
-                }
+            // holder can be removed and deleted at remove of expired or other auras, check by pointer without access
+            if (!HasSpellAuraHolder(itr->first, holder))
+                break;
 
-                if (!removedAura)
-                    ++iter;
-                else
-                    iter = m_spellAuraHolders.begin();
-            }
-            else
-                ++iter;
+            if (Aura *aura = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
+                if (!aura->GetAuraDuration())
+                    RemoveSingleAuraFromSpellAuraHolder(holder, aura->GetEffIndex(), AURA_REMOVE_BY_EXPIRE);
         }
-        else
-            ++iter;
     }
 
     if(!m_gameObj.empty())
@@ -3622,50 +3626,71 @@ void Unit::DeMorph()
     SetDisplayId(GetNativeDisplayId());
 }
 
-int32 Unit::GetTotalAuraModifier(AuraType auratype) const
+Unit::AuraModifierTotals const& Unit::GetAuraModifierTotals(AuraType auratype) const
 {
-    int32 modifier = 0;
+    if (!m_auraModifierTotals)
+    {
+        m_auraModifierTotals = new AuraModifierTotals[TOTAL_AURAS];
+        for (int i = 0; i < TOTAL_AURAS; ++i)
+            m_auraModifierTotals[i].generation = 0;
+    }
+
+    AuraModifierTotals& totals = m_auraModifierTotals[auratype];
+    if (totals.generation == m_auraModifierTotalsGeneration)
+        return totals;
+
+    totals.generation = m_auraModifierTotalsGeneration;
+    totals.total = 0;
+    totals.multiplier = 1.0f;
+    totals.maxPositive = 0;
+    totals.maxNegative = 0;
 
     AuraList const& mTotalAuraList = GetAurasByType(auratype);
     for(AuraList::const_iterator i = mTotalAuraList.begin();i != mTotalAuraList.end(); ++i)
-        modifier += (*i)->GetModifier()->m_amount;
+    {
+        int32 amount = (*i)->GetModifier()->m_amount;
 
-    return modifier;
+        totals.total += amount;
+        totals.multiplier *= (100.0f + amount)/100.0f;
+        if (amount > totals.maxPositive)
+            totals.maxPositive = amount;
+        if (amount < totals.maxNegative)
+            totals.maxNegative = amount;
+    }
+
+    return totals;
 }
 
-float Unit::GetTotalAuraMultiplier(AuraType auratype) const
+int32 Unit::GetTotalAuraModifier(AuraType auratype) const
 {
-    float multiplier = 1.0f;
+    if (m_modAuras[auratype].empty())
+        return 0;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for(AuraList::const_iterator i = mTotalAuraList.begin();i != mTotalAuraList.end(); ++i)
-        multiplier *= (100.0f + (*i)->GetModifier()->m_amount)/100.0f;
+    return GetAuraModifierTotals(auratype).total;
+}
 
-    return multiplier;
+float Unit::GetTotalAuraMultiplier(AuraType auratype) const
+{
+    if (m_modAuras[auratype].empty())
+        return 1.0f;
+
+    return GetAuraModifierTotals(auratype).multiplier;
 }
 
 int32 Unit::GetMaxPositiveAuraModifier(AuraType auratype) const
 {
-    int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for(AuraList::const_iterator i = mTotalAuraList.begin();i != mTotalAuraList.end(); ++i)
-        if ((*i)->GetModifier()->m_amount > modifier)
-            modifier = (*i)->GetModifier()->m_amount;
+    if (m_modAuras[auratype].empty())
+        return 0;
 
-    return modifier;
+    return GetAuraModifierTotals(auratype).maxPositive;
 }
 
 int32 Unit::GetMaxNegativeAuraModifier(AuraType auratype) const
 {
-    int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for(AuraList::const_iterator i = mTotalAuraList.begin();i != mTotalAuraList.end(); ++i)
-        if ((*i)->GetModifier()->m_amount < modifier)
-            modifier = (*i)->GetModifier()->m_amount;
+    if (m_modAuras[auratype].empty())
+        return 0;
 
-    return modifier;
+    return GetAuraModifierTotals(auratype).maxNegative;
 }
 
 int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask) const
@@ -3979,6 +4004,8 @@ bool Unit::AddSpellAuraHolder(SpellAuraHolder *holder)
     // add aura, register in lists and arrays
     holder->_AddSpellAuraHolder();
     m_spellAuraHolders.insert(SpellAuraHolderMap::value_type(holder->GetId(), holder));
+    if (holder->GetProcFlags())
+        m_procAuraHolders.insert(SpellAuraHolderMap::value_type(holder->GetId(), holder));
 
     for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
         if (Aura *aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
@@ -4000,7 +4027,10 @@ bool Unit::AddSpellAuraHolder(SpellAuraHolder *holder)
 void Unit::AddAuraToModList(Aura *aura)
 {
     if (aura->GetModifier()->m_auraname < TOTAL_AURAS)
+    {
         m_modAuras[aura->GetModifier()->m_auraname].push_back(aura);
+        InvalidateAuraModifierTotals();
+    }
 }
 
 void Unit::RemoveRankAurasDueToSpell(uint32 spellId)
@@ -4552,6 +4582,19 @@ void Unit::RemoveSpellAuraHolder(SpellAuraHolder *holder, AuraRemoveMode mode)
         }
     }
 
+    if (holder->GetProcFlags())
+    {
+        bounds = m_procAuraHolders.equal_range(holder->GetId());
+        for (SpellAuraHolderMap::iterator itr = bounds.first; itr != bounds.second; ++itr)
+        {
+            if (itr->second == holder)
+            {
+                m_procAuraHolders.erase(itr);
+                break;
+            }
+        }
+    }
+
     holder->SetRemoveMode(mode);
     holder->UnregisterSingleCastHolder();
 
@@ -4603,6 +4646,7 @@ void Unit::RemoveAura(Aura *Aur, AuraRemoveMode mode)
     if (Aur->GetModifier()->m_auraname < TOTAL_AURAS)
     {
         m_modAuras[Aur->GetModifier()->m_auraname].remove(Aur);
+        InvalidateAuraModifierTotals();
     }
 
     // Set remove mode
@@ -9469,8 +9513,9 @@ void Unit::ProcDamageAndSpellFor( bool isVictim, Unit * pTarget, uint32 procFlag
 
     RemoveSpellList removedSpells;
     ProcTriggeredList procTriggered;
-    // Fill procTriggered list
-    for(SpellAuraHolderMap::const_iterator itr = GetSpellAuraHolderMap().begin(); itr!= GetSpellAuraHolderMap().end(); ++itr)
+    // Fill procTriggered list, only from holders that had proc flags at apply
+    // current spell_proc_event data checked in IsTriggeredAtSpellProcEvent
+    for(SpellAuraHolderMap::const_iterator itr = m_procAuraHolders.begin(); itr!= m_procAuraHolders.end(); ++itr)
     {
         // skip deleted auras (possible at recursive triggered call
         if(itr->second->IsDeleted())
@@ -10482,6 +10527,16 @@ void Unit::StopAttackFaction(uint32 faction_id)
     CallForAllControlledUnits(StopAttackFactionHelper(faction_id),false,true,true);
 }
 
+bool Unit::HasSpellAuraHolder(uint32 spellId, SpellAuraHolder const* holder) const
+{
+    SpellAuraHolderConstBounds bounds = GetSpellAuraHolderBounds(spellId);
+    for (SpellAuraHolderMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+        if (itr->second == holder)
+            return true;
+
+    return false;
+}
+
 void Unit::CleanupDeletedAuras()
 {
     for (SpellAuraHolderList::const_iterator iter = m_deletedHolders.begin(); iter != m_deletedHolders.end(); ++iter)
@@ -1376,6 +1376,7 @@ class MANGOS_DLL_SPEC Unit : public WorldObject
         {
             return m_spellAuraHolders.find(spellId) != m_spellAuraHolders.end();
         }
+        bool HasSpellAuraHolder(uint32 spellId, SpellAuraHolder const* holder) const;
 
         bool virtual HasSpell(uint32 /*spellID*/) const { return false; }
 
@@ -1720,6 +1721,13 @@ class MANGOS_DLL_SPEC Unit : public WorldObject
         // misc have plain value but we check it fit to provided values mask (mask & (1 << (misc-1)))
         float GetTotalAuraMultiplierByMiscValueForMask(AuraType auratype, uint32 mask) const;
 
+        // must be called at any change of modifier amount of aura in m_modAuras lists outside Aura::ApplyModifier
+        void InvalidateAuraModifierTotals()
+        {
+            if (!++m_auraModifierTotalsGeneration)          // 0 used for never calculated totals
+                ++m_auraModifierTotalsGeneration;
+        }
+
         Aura* GetDummyAura(uint32 spell_id) const;
 
         uint32 m_AuraFlags;
@@ -1906,6 +1914,7 @@ class MANGOS_DLL_SPEC Unit : public WorldObject
 
         SpellAuraHolderMap m_spellAuraHolders;
         SpellAuraHolderMap::iterator m_spellAuraHoldersUpdateIterator; // != end() in Unit::m_spellAuraHolders update and point to next element
+        SpellAuraHolderMap m_procAuraHolders;               // holders from m_spellAuraHolders with proc flags, checked at proc events
         AuraList m_deletedAuras;                                       // auras removed while in ApplyModifier and waiting deleted
         SpellAuraHolderList m_deletedHolders;
 
@@ -1920,6 +1929,22 @@ class MANGOS_DLL_SPEC Unit : public WorldObject
         uint32 m_transform;
 
         AuraList m_modAuras[TOTAL_AURAS];
+
+        // totals of not misc value dependent GetTotalAuraModifier and etc, recalculated at first call after invalidation
+        struct AuraModifierTotals
+        {
+            uint32 generation;
+            int32 total;
+            float multiplier;
+            int32 maxPositive;
+            int32 maxNegative;
+        };
+
+        AuraModifierTotals const& GetAuraModifierTotals(AuraType auratype) const;
+
+        mutable AuraModifierTotals* m_auraModifierTotals;   // TOTAL_AURAS elements, allocated at first use
+        uint32 m_auraModifierTotalsGeneration;
+
         float m_auraModifiersGroup[UNIT_MOD_END][MODIFIER_TYPE_END];
         float m_weaponDamage[MAX_ATTACK][2];
         bool m_canModifyStats;
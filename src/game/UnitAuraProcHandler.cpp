@@ -1034,6 +1034,7 @@ SpellAuraProcResult Unit::HandleDummyAuraProc(Unit *pVictim, uint32 damage, Aura
 
                 // Count spell criticals in a row in second aura
                 Modifier *mod = counter->GetModifier();
+                InvalidateAuraModifierTotals();
                 if (procEx & PROC_EX_CRITICAL_HIT)
                 {
                     mod->m_amount *=2;
@@ -1209,6 +1210,7 @@ SpellAuraProcResult Unit::HandleDummyAuraProc(Unit *pVictim, uint32 damage, Aura
 
                 // Damage counting
                 mod->m_amount-=damage;
+                InvalidateAuraModifierTotals();
                 return SPELL_AURA_PROC_OK;
             }
             // Seed of Corruption (Mobs cast) - no die req
@@ -1230,6 +1232,7 @@ SpellAuraProcResult Unit::HandleDummyAuraProc(Unit *pVictim, uint32 damage, Aura
                 }
                 // Damage counting
                 mod->m_amount-=damage;
+                InvalidateAuraModifierTotals();
                 return SPELL_AURA_PROC_OK;
             }
             // Fel Synergy
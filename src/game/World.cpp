@@ -61,6 +61,8 @@
 #include "GMTicketMgr.h"
 #include "Util.h"
 #include "CharacterDatabaseCleaner.h"
+#include "StartupLoader.h"
+#include "PlayerSaveScheduler.h"
 
 INSTANTIATE_SINGLETON_1( World );
 
@@ -516,10 +518,13 @@ void World::LoadConfigSettings(bool reload)
     setConfigMinMax(CONFIG_UINT32_COMPRESSION, "Compression", 1, 1, 9);
     setConfig(CONFIG_BOOL_ADDON_CHANNEL, "AddonChannel", true);
     setConfig(CONFIG_BOOL_CLEAN_CHARACTER_DB, "CleanCharacterDB", true);
+    setConfigMin(CONFIG_UINT32_STARTUP_LOAD_THREADS, "StartupLoadThreads", 1, 1);
     setConfig(CONFIG_BOOL_GRID_UNLOAD, "GridUnload", true);
     setConfigPos(CONFIG_UINT32_INTERVAL_SAVE, "PlayerSave.Interval", 15 * MINUTE * IN_MILLISECONDS);
     setConfigMinMax(CONFIG_UINT32_MIN_LEVEL_STAT_SAVE, "PlayerSave.Stats.MinLevel", 0, 0, MAX_LEVEL);
     setConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT, "PlayerSave.Stats.SaveOnlyOnLogout", true);
+    setConfig(CONFIG_UINT32_SAVE_MAX_PER_TICK, "PlayerSave.MaxPerTick", 10);
+    setConfig(CONFIG_UINT32_SAVE_MAX_STATEMENTS_PER_TICK, "PlayerSave.MaxStatementsPerTick", 0);
 
     setConfigMin(CONFIG_UINT32_INTERVAL_GRIDCLEAN, "GridCleanUpDelay", 5 * MINUTE * IN_MILLISECONDS, MIN_GRID_DELAY);
     if (reload)
@@ -853,6 +858,18 @@ void World::LoadConfigSettings(bool reload)
         sLog.outString("Using DataDir %s",m_dataPath.c_str());
     }
 
+    ///- Read the static data snapshot directory, used only at server start
+    std::string snapshotPath = sConfig.GetStringDefault("SnapshotDir", "");
+    if (!snapshotPath.empty() && snapshotPath.at(snapshotPath.length()-1)!='/' && snapshotPath.at(snapshotPath.length()-1)!='\\')
+        snapshotPath.append("/");
+
+    if (!reload)
+    {
+        SQLStorage::SetCacheDirectory(snapshotPath);
+        if (!snapshotPath.empty())
+            sLog.outString("Using SnapshotDir %s", snapshotPath.c_str());
+    }
+
     setConfig(CONFIG_BOOL_VMAP_INDOOR_CHECK, "vmap.enableIndoorCheck", true);
     bool enableLOS = sConfig.GetBoolDefault("vmap.enableLOS", false);
     bool enableHeight = sConfig.GetBoolDefault("vmap.enableHeight", false);
@@ -865,6 +882,12 @@ void World::LoadConfigSettings(bool reload)
     sLog.outString( "WORLD: VMap support included. LineOfSight:%i, getHeight:%i",enableLOS, enableHeight);
     sLog.outString( "WORLD: VMap data directory is: %svmaps",m_dataPath.c_str());
     sLog.outString( "WORLD: VMap config keys are: vmap.enableLOS, vmap.enableHeight, vmap.ignoreMapIds, vmap.ignoreSpellIds");
+
+    if (configNoReload(reload, CONFIG_BOOL_PATHFINDING_ENABLED, "PathFinding.Enable", false))
+        setConfig(CONFIG_BOOL_PATHFINDING_ENABLED, "PathFinding.Enable", false);
+    setConfigMin(CONFIG_UINT32_PATHFINDING_MAX_NODES, "PathFinding.MaxSearchNodes", 3000, 100);
+    setConfig(CONFIG_UINT32_PATHFINDING_CACHE_SIZE, "PathFinding.CacheSize", 1024);
+    sLog.outString( "WORLD: Path finding support %s, move map data directory is: %smmaps", getConfig(CONFIG_BOOL_PATHFINDING_ENABLED) ? "enabled" : "disabled", m_dataPath.c_str());
 }
 
 /// Initialize the World
@@ -898,15 +921,6 @@ void World::SetInitialWorldSettings()
         exit(1);
     }
 
-    ///- Loading strings. Getting no records means core load has to be canceled because no error message can be output.
-    sLog.outString();
-    sLog.outString("Loading MaNGOS strings...");
-    if (!sObjectMgr.LoadMangosStrings())
-    {
-        Log::WaitBeforeContinueIfNeed();
-        exit(1);                                            // Error message displayed in function already
-    }
-
     ///- Update the realm entry in the database with the realm type from the config file
     //No SQL injection as values are treated as integers
 
@@ -918,326 +932,12 @@ void World::SetInitialWorldSettings()
     ///- Remove the bones (they should not exist in DB though) and old corpses after a restart
     CharacterDatabase.PExecute("DELETE FROM corpse WHERE corpse_type = '0' OR time < (UNIX_TIMESTAMP()-'%u')", 3*DAY);
 
-    ///- Load the DBC files
-    sLog.outString("Initialize data stores...");
-    LoadDBCStores(m_dataPath);
-    DetectDBCLang();
-
-    sLog.outString( "Loading Script Names...");
-    sObjectMgr.LoadScriptNames();
-
-    sLog.outString( "Loading InstanceTemplate..." );
-    sObjectMgr.LoadInstanceTemplate();
-
-    sLog.outString( "Loading SkillLineAbilityMultiMap Data..." );
-    sSpellMgr.LoadSkillLineAbilityMap();
-
-    ///- Clean up and pack instances
-    sLog.outString( "Cleaning up instances..." );
-    sInstanceSaveMgr.CleanupInstances();                // must be called before `creature_respawn`/`gameobject_respawn` tables
-
-    sLog.outString( "Packing instances..." );
-    sInstanceSaveMgr.PackInstances();
-
-    sLog.outString( "Packing groups..." );
-    sObjectMgr.PackGroupIds();
-
-    sLog.outString();
-    sLog.outString( "Loading Localization strings..." );
-    sObjectMgr.LoadCreatureLocales();
-    sObjectMgr.LoadGameObjectLocales();
-    sObjectMgr.LoadItemLocales();
-    sObjectMgr.LoadQuestLocales();
-    sObjectMgr.LoadNpcTextLocales();
-    sObjectMgr.LoadPageTextLocales();
-    sObjectMgr.LoadGossipMenuItemsLocales();
-    sObjectMgr.LoadPointOfInterestLocales();
-    sObjectMgr.SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
-    sLog.outString( ">>> Localization strings loaded" );
-    sLog.outString();
-
-    sLog.outString( "Loading Page Texts..." );
-    sObjectMgr.LoadPageTexts();
-
-    sLog.outString( "Loading Game Object Templates..." );   // must be after LoadPageTexts
-    sObjectMgr.LoadGameobjectInfo();
-
-    sLog.outString( "Loading Spell Chain Data..." );
-    sSpellMgr.LoadSpellChains();
-
-    sLog.outString( "Loading Spell Elixir types..." );
-    sSpellMgr.LoadSpellElixirs();
-
-    sLog.outString( "Loading Spell Learn Skills..." );
-    sSpellMgr.LoadSpellLearnSkills();                        // must be after LoadSpellChains
-
-    sLog.outString( "Loading Spell Learn Spells..." );
-    sSpellMgr.LoadSpellLearnSpells();
-
-    sLog.outString( "Loading Spell Proc Event conditions..." );
-    sSpellMgr.LoadSpellProcEvents();
-
-    sLog.outString( "Loading Spell Bonus Data..." );
-    sSpellMgr.LoadSpellBonuses();                           // must be after LoadSpellChains
-
-    sLog.outString( "Loading Spell Proc Item Enchant..." );
-    sSpellMgr.LoadSpellProcItemEnchant();                   // must be after LoadSpellChains
-
-    sLog.outString( "Loading Aggro Spells Definitions...");
-    sSpellMgr.LoadSpellThreats();
-
-    sLog.outString( "Loading NPC Texts..." );
-    sObjectMgr.LoadGossipText();
-
-    sLog.outString( "Loading Item Random Enchantments Table..." );
-    LoadRandomEnchantmentsTable();
-
-    sLog.outString( "Loading Items..." );                   // must be after LoadRandomEnchantmentsTable and LoadPageTexts
-    sObjectMgr.LoadItemPrototypes();
-
-    sLog.outString( "Loading Creature Model Based Info Data..." );
-    sObjectMgr.LoadCreatureModelInfo();
-
-    sLog.outString( "Loading Equipment templates...");
-    sObjectMgr.LoadEquipmentTemplates();
-
-    sLog.outString( "Loading Creature templates..." );
-    sObjectMgr.LoadCreatureTemplates();
-
-    sLog.outString( "Loading SpellsScriptTarget...");
-    sSpellMgr.LoadSpellScriptTarget();                       // must be after LoadCreatureTemplates and LoadGameobjectInfo
-
-    sLog.outString( "Loading ItemRequiredTarget...");
-    sObjectMgr.LoadItemRequiredTarget();
-
-    sLog.outString( "Loading Reputation Reward Rates...");
-    sObjectMgr.LoadReputationRewardRate();
-
-    sLog.outString( "Loading Creature Reputation OnKill Data..." );
-    sObjectMgr.LoadReputationOnKill();
-
-    sLog.outString( "Loading Reputation Spillover Data..." );
-    sObjectMgr.LoadReputationSpilloverTemplate();
-
-    sLog.outString( "Loading Points Of Interest Data..." );
-    sObjectMgr.LoadPointsOfInterest();
-
-    sLog.outString( "Loading Creature Data..." );
-    sObjectMgr.LoadCreatures();
-
-    sLog.outString( "Loading pet levelup spells..." );
-    sSpellMgr.LoadPetLevelupSpellMap();
-
-    sLog.outString( "Loading pet default spell additional to levelup spells..." );
-    sSpellMgr.LoadPetDefaultSpells();
-
-    sLog.outString( "Loading Creature Addon Data..." );
-    sLog.outString();
-    sObjectMgr.LoadCreatureAddons();                            // must be after LoadCreatureTemplates() and LoadCreatures()
-    sLog.outString( ">>> Creature Addon Data loaded" );
-    sLog.outString();
-
-    sLog.outString( "Loading Creature Respawn Data..." );   // must be after PackInstances()
-    sObjectMgr.LoadCreatureRespawnTimes();
-
-    sLog.outString( "Loading Gameobject Data..." );
-    sObjectMgr.LoadGameobjects();
-
-    sLog.outString( "Loading Gameobject Respawn Data..." ); // must be after PackInstances()
-    sObjectMgr.LoadGameobjectRespawnTimes();
-
-    sLog.outString( "Loading Objects Pooling Data...");
-    sPoolMgr.LoadFromDB();
-
-    sLog.outString( "Loading Game Event Data...");          // must be after sPoolMgr.LoadFromDB for proper load pool events
-    sLog.outString();
-    sGameEventMgr.LoadFromDB();
-    sLog.outString( ">>> Game Event Data loaded" );
-    sLog.outString();
-
-    sLog.outString( "Loading Weather Data..." );
-    sObjectMgr.LoadWeatherZoneChances();
-
-    sLog.outString( "Loading Quests..." );
-    sObjectMgr.LoadQuests();                                    // must be loaded after DBCs, creature_template, item_template, gameobject tables
-
-    sLog.outString( "Loading Quest POI" );
-    sObjectMgr.LoadQuestPOI();
-
-    sLog.outString( "Loading Quests Relations..." );
-    sLog.outString();
-    sObjectMgr.LoadQuestRelations();                            // must be after quest load
-    sLog.outString( ">>> Quests Relations loaded" );
-    sLog.outString();
-
-    sLog.outString( "Loading UNIT_NPC_FLAG_SPELLCLICK Data..." );
-    sObjectMgr.LoadNPCSpellClickSpells();
-
-    sLog.outString( "Loading SpellArea Data..." );          // must be after quest load
-    sSpellMgr.LoadSpellAreas();
-
-    sLog.outString( "Loading AreaTrigger definitions..." );
-    sObjectMgr.LoadAreaTriggerTeleports();                      // must be after item template load
-
-    sLog.outString( "Loading Quest Area Triggers..." );
-    sObjectMgr.LoadQuestAreaTriggers();                         // must be after LoadQuests
-
-    sLog.outString( "Loading Tavern Area Triggers..." );
-    sObjectMgr.LoadTavernAreaTriggers();
-
-    sLog.outString( "Loading AreaTrigger script names..." );
-    sObjectMgr.LoadAreaTriggerScripts();
-
-    sLog.outString( "Loading event id script names..." );
-    sObjectMgr.LoadEventIdScripts();
-
-    sLog.outString( "Loading Graveyard-zone links...");
-    sObjectMgr.LoadGraveyardZones();
-
-    sLog.outString( "Loading Spell target coordinates..." );
-    sSpellMgr.LoadSpellTargetPositions();
-
-    sLog.outString( "Loading spell pet auras..." );
-    sSpellMgr.LoadSpellPetAuras();
-
-    sLog.outString( "Loading Player Create Info & Level Stats..." );
-    sLog.outString();
-    sObjectMgr.LoadPlayerInfo();
-    sLog.outString( ">>> Player Create Info & Level Stats loaded" );
-    sLog.outString();
-
-    sLog.outString( "Loading Exploration BaseXP Data..." );
-    sObjectMgr.LoadExplorationBaseXP();
-
-    sLog.outString( "Loading Pet Name Parts..." );
-    sObjectMgr.LoadPetNames();
-
-    CharacterDatabaseCleaner::CleanDatabase();
-
-    sLog.outString( "Loading the max pet number..." );
-    sObjectMgr.LoadPetNumber();
-
-    sLog.outString( "Loading pet level stats..." );
-    sObjectMgr.LoadPetLevelInfo();
-
-    sLog.outString( "Loading Player Corpses..." );
-    sObjectMgr.LoadCorpses();
-
-    sLog.outString( "Loading Player level dependent mail rewards..." );
-    sObjectMgr.LoadMailLevelRewards();
-
-    sLog.outString( "Loading Loot Tables..." );
-    sLog.outString();
-    LoadLootTables();
-    sLog.outString( ">>> Loot Tables loaded" );
-    sLog.outString();
-
-    sLog.outString( "Loading Skill Discovery Table..." );
-    LoadSkillDiscoveryTable();
-
-    sLog.outString( "Loading Skill Extra Item Table..." );
-    LoadSkillExtraItemTable();
-
-    sLog.outString( "Loading Skill Fishing base level requirements..." );
-    sObjectMgr.LoadFishingBaseSkillLevel();
-
-    sLog.outString( "Loading Achievements..." );
-    sLog.outString();
-    sAchievementMgr.LoadAchievementReferenceList();
-    sAchievementMgr.LoadAchievementCriteriaList();
-    sAchievementMgr.LoadAchievementCriteriaRequirements();
-    sAchievementMgr.LoadRewards();
-    sAchievementMgr.LoadRewardLocales();
-    sAchievementMgr.LoadCompletedAchievements();
-    sLog.outString( ">>> Achievements loaded" );
-    sLog.outString();
-
-    ///- Load dynamic data tables from the database
-    sLog.outString( "Loading Auctions..." );
-    sLog.outString();
-    sAuctionMgr.LoadAuctionItems();
-    sAuctionMgr.LoadAuctions();
-    sLog.outString( ">>> Auctions loaded" );
-    sLog.outString();
-
-    sLog.outString( "Loading Guilds..." );
-    sObjectMgr.LoadGuilds();
-
-    sLog.outString( "Loading ArenaTeams..." );
-    sObjectMgr.LoadArenaTeams();
-
-    sLog.outString( "Loading Groups..." );
-    sObjectMgr.LoadGroups();
-
-    sLog.outString( "Loading ReservedNames..." );
-    sObjectMgr.LoadReservedPlayersNames();
-
-    sLog.outString( "Loading GameObjects for quests..." );
-    sObjectMgr.LoadGameObjectForQuests();
-
-    sLog.outString( "Loading BattleMasters..." );
-    sBattleGroundMgr.LoadBattleMastersEntry();
-
-    sLog.outString( "Loading BattleGround event indexes..." );
-    sBattleGroundMgr.LoadBattleEventIndexes();
-
-    sLog.outString( "Loading GameTeleports..." );
-    sObjectMgr.LoadGameTele();
-
-    sLog.outString( "Loading Npc Text Id..." );
-    sObjectMgr.LoadNpcTextId();                                 // must be after load Creature and NpcText
-
-    sLog.outString( "Loading Gossip scripts..." );
-    sObjectMgr.LoadGossipScripts();                             // must be before gossip menu options
-
-    sLog.outString( "Loading Gossip menus..." );
-    sObjectMgr.LoadGossipMenu();
-
-    sLog.outString( "Loading Gossip menu options..." );
-    sObjectMgr.LoadGossipMenuItems();
-
-    sLog.outString( "Loading Vendors..." );
-    sObjectMgr.LoadVendors();                                   // must be after load CreatureTemplate and ItemTemplate
-
-    sLog.outString( "Loading Trainers..." );
-    sObjectMgr.LoadTrainerSpell();                              // must be after load CreatureTemplate
-
-    sLog.outString( "Loading Waypoint scripts..." );            // before loading from creature_movement
-    sObjectMgr.LoadCreatureMovementScripts();
-
-    sLog.outString( "Loading Waypoints..." );
-    sLog.outString();
-    sWaypointMgr.Load();
-
-    sLog.outString( "Loading GM tickets...");
-    sTicketMgr.LoadGMTickets();
-
-    ///- Handle outdated emails (delete/return)
-    sLog.outString( "Returning old mails..." );
-    sObjectMgr.ReturnOrDeleteOldMails(false);
-
-    ///- Load and initialize scripts
-    sLog.outString( "Loading Scripts..." );
-    sLog.outString();
-    sObjectMgr.LoadQuestStartScripts();                         // must be after load Creature/Gameobject(Template/Data) and QuestTemplate
-    sObjectMgr.LoadQuestEndScripts();                           // must be after load Creature/Gameobject(Template/Data) and QuestTemplate
-    sObjectMgr.LoadSpellScripts();                              // must be after load Creature/Gameobject(Template/Data)
-    sObjectMgr.LoadGameObjectScripts();                         // must be after load Creature/Gameobject(Template/Data)
-    sObjectMgr.LoadEventScripts();                              // must be after load Creature/Gameobject(Template/Data)
-    sLog.outString( ">>> Scripts loaded" );
-    sLog.outString();
-
-    sLog.outString( "Loading Scripts text locales..." );    // must be after Load*Scripts calls
-    sObjectMgr.LoadDbScriptStrings();
-
-    sLog.outString( "Loading CreatureEventAI Texts...");
-    sEventAIMgr.LoadCreatureEventAI_Texts(false);       // false, will checked in LoadCreatureEventAI_Scripts
-
-    sLog.outString( "Loading CreatureEventAI Summons...");
-    sEventAIMgr.LoadCreatureEventAI_Summons(false);     // false, will checked in LoadCreatureEventAI_Scripts
-
-    sLog.outString( "Loading CreatureEventAI Scripts...");
-    sEventAIMgr.LoadCreatureEventAI_Scripts();
+    ///- Load static and dynamic data, steps without dependency between them can be loaded concurrently
+    if (!LoadStartupData())
+    {
+        Log::WaitBeforeContinueIfNeed();
+        exit(1);                                            // Error message displayed in function already
+    }
 
     sLog.outString( "Initializing Scripts..." );
     if(!LoadScriptingModule())
@@ -1321,6 +1021,230 @@ void World::SetInitialWorldSettings()
     sLog.outString( "SERVER STARTUP TIME: %i minutes %i seconds", uStartInterval / 60000, (uStartInterval % 60000) / 1000 );
 }
 
+// Helpers for startup loading steps that group several loaders or need arguments
+
+static bool LoadMangosStringsStep()
+{
+    ///- Getting no records means core load has to be canceled because no error message can be output.
+    return sObjectMgr.LoadMangosStrings();
+}
+
+static void LoadLocalizationStrings()
+{
+    sObjectMgr.LoadCreatureLocales();
+    sObjectMgr.LoadGameObjectLocales();
+    sObjectMgr.LoadItemLocales();
+    sObjectMgr.LoadQuestLocales();
+    sObjectMgr.LoadNpcTextLocales();
+    sObjectMgr.LoadPageTextLocales();
+    sObjectMgr.LoadGossipMenuItemsLocales();
+    sObjectMgr.LoadPointOfInterestLocales();
+    sObjectMgr.SetDBCLocaleIndex(sWorld.GetDefaultDbcLocale());   // Get once for all the locale index of DBC language (console/broadcasts)
+    sLog.outString( ">>> Localization strings loaded" );
+    sLog.outString();
+}
+
+static void LoadSpellBaseData()
+{
+    sLog.outString( "Loading Spell Chain Data..." );
+    sSpellMgr.LoadSpellChains();
+
+    sLog.outString( "Loading Spell Elixir types..." );
+    sSpellMgr.LoadSpellElixirs();
+
+    sLog.outString( "Loading Spell Learn Skills..." );
+    sSpellMgr.LoadSpellLearnSkills();                       // must be after LoadSpellChains
+
+    sLog.outString( "Loading Spell Learn Spells..." );
+    sSpellMgr.LoadSpellLearnSpells();
+
+    sLog.outString( "Loading Spell Proc Event conditions..." );
+    sSpellMgr.LoadSpellProcEvents();
+
+    sLog.outString( "Loading Spell Bonus Data..." );
+    sSpellMgr.LoadSpellBonuses();                           // must be after LoadSpellChains
+
+    sLog.outString( "Loading Spell Proc Item Enchant..." );
+    sSpellMgr.LoadSpellProcItemEnchant();                   // must be after LoadSpellChains
+
+    sLog.outString( "Loading Aggro Spells Definitions...");
+    sSpellMgr.LoadSpellThreats();
+}
+
+static void LoadAchievementData()
+{
+    sAchievementMgr.LoadAchievementReferenceList();
+    sAchievementMgr.LoadAchievementCriteriaList();
+    sAchievementMgr.LoadAchievementCriteriaRequirements();
+    sAchievementMgr.LoadRewards();
+    sAchievementMgr.LoadRewardLocales();
+    sLog.outString( ">>> Achievements loaded" );
+    sLog.outString();
+}
+
+static void LoadAuctionData()
+{
+    sAuctionMgr.LoadAuctionItems();
+    sAuctionMgr.LoadAuctions();
+    sLog.outString( ">>> Auctions loaded" );
+    sLog.outString();
+}
+
+static void ReturnOldMails()
+{
+    sObjectMgr.ReturnOrDeleteOldMails(false);
+}
+
+static void LoadCreatureEventAITexts()
+{
+    sEventAIMgr.LoadCreatureEventAI_Texts(false);           // false, will checked in LoadCreatureEventAI_Scripts
+}
+
+static void LoadCreatureEventAISummons()
+{
+    sEventAIMgr.LoadCreatureEventAI_Summons(false);         // false, will checked in LoadCreatureEventAI_Scripts
+}
+
+void World::LoadDBCData()
+{
+    LoadDBCStores(m_dataPath);
+    DetectDBCLang();
+}
+
+/**
+ * Describe all data loading steps with their dependencies and run them, return false if loading failed.
+ * Steps writing to database are chained to keep same writes order as at sequential loading.
+ * Steps calling LoadMangosStrings or GetOrNewIndexForLocale are chained because share locale tables.
+ * Loot and gossip steps share condition store, ObjectMgr::GetConditionId guard it by own lock.
+ */
+bool World::LoadStartupData()
+{
+    StartupLoader loader;
+
+    loader.AddTask("mangos_string",             "Loading MaNGOS strings...", &LoadMangosStringsStep);
+    loader.AddTask("dbc",                       "Initialize data stores...", *this, &World::LoadDBCData);
+    loader.AddTask("script_names",              "Loading Script Names...", sObjectMgr, &ObjectMgr::LoadScriptNames);
+    loader.AddTask("instance_template",         "Loading InstanceTemplate...", sObjectMgr, &ObjectMgr::LoadInstanceTemplate, "dbc script_names");
+    loader.AddTask("skill_line_ability",        "Loading SkillLineAbilityMultiMap Data...", sSpellMgr, &SpellMgr::LoadSkillLineAbilityMap, "dbc");
+
+    // must be called before `creature_respawn`/`gameobject_respawn` tables
+    loader.AddTask("cleanup_instances",         "Cleaning up instances...", sInstanceSaveMgr, &InstanceSaveManager::CleanupInstances, "dbc instance_template");
+    loader.AddTask("pack_instances",            "Packing instances...", sInstanceSaveMgr, &InstanceSaveManager::PackInstances, "cleanup_instances");
+    loader.AddTask("pack_groups",               "Packing groups...", sObjectMgr, &ObjectMgr::PackGroupIds, "pack_instances");
+
+    loader.AddTask("locales",                   "Loading Localization strings...", &LoadLocalizationStrings, "dbc mangos_string");
+
+    loader.AddTask("page_text",                 "Loading Page Texts...", sObjectMgr, &ObjectMgr::LoadPageTexts, "dbc");
+    loader.AddTask("gameobject_template",       "Loading Game Object Templates...", sObjectMgr, &ObjectMgr::LoadGameobjectInfo, "dbc script_names page_text");
+    loader.AddTask("spell_data",                "Loading Spell Data...", &LoadSpellBaseData, "dbc skill_line_ability");
+    loader.AddTask("npc_text",                  "Loading NPC Texts...", sObjectMgr, &ObjectMgr::LoadGossipText, "dbc");
+    loader.AddTask("item_enchantment_template", "Loading Item Random Enchantments Table...", &LoadRandomEnchantmentsTable, "dbc");
+    loader.AddTask("item_template",             "Loading Items...", sObjectMgr, &ObjectMgr::LoadItemPrototypes, "dbc script_names page_text item_enchantment_template");
+    loader.AddTask("creature_model_info",       "Loading Creature Model Based Info Data...", sObjectMgr, &ObjectMgr::LoadCreatureModelInfo, "dbc");
+    loader.AddTask("equipment_template",        "Loading Equipment templates...", sObjectMgr, &ObjectMgr::LoadEquipmentTemplates, "dbc");
+    loader.AddTask("creature_template",         "Loading Creature templates...", sObjectMgr, &ObjectMgr::LoadCreatureTemplates, "dbc script_names creature_model_info equipment_template");
+    loader.AddTask("spell_script_target",       "Loading SpellsScriptTarget...", sSpellMgr, &SpellMgr::LoadSpellScriptTarget, "spell_data creature_template gameobject_template");
+    loader.AddTask("item_required_target",      "Loading ItemRequiredTarget...", sObjectMgr, &ObjectMgr::LoadItemRequiredTarget, "item_template creature_template spell_script_target");
+    loader.AddTask("reputation_reward_rate",    "Loading Reputation Reward Rates...", sObjectMgr, &ObjectMgr::LoadReputationRewardRate, "dbc");
+    loader.AddTask("reputation_onkill",         "Loading Creature Reputation OnKill Data...", sObjectMgr, &ObjectMgr::LoadReputationOnKill, "dbc creature_template");
+    loader.AddTask("reputation_spillover",      "Loading Reputation Spillover Data...", sObjectMgr, &ObjectMgr::LoadReputationSpilloverTemplate, "dbc");
+    loader.AddTask("points_of_interest",        "Loading Points Of Interest Data...", sObjectMgr, &ObjectMgr::LoadPointsOfInterest, "dbc");
+
+    // creatures, gameobjects and corpses share grid object lists
+    loader.AddTask("creatures",                 "Loading Creature Data...", sObjectMgr, &ObjectMgr::LoadCreatures, "dbc creature_template");
+    loader.AddTask("pet_levelup_spells",        "Loading pet levelup spells...", sSpellMgr, &SpellMgr::LoadPetLevelupSpellMap, "dbc skill_line_ability spell_data");
+    loader.AddTask("pet_default_spells",        "Loading pet default spell additional to levelup spells...", sSpellMgr, &SpellMgr::LoadPetDefaultSpells, "creature_template pet_levelup_spells");
+    loader.AddTask("creature_addon",            "Loading Creature Addon Data...", sObjectMgr, &ObjectMgr::LoadCreatureAddons, "creature_template creatures");
+    loader.AddTask("creature_respawn",          "Loading Creature Respawn Data...", sObjectMgr, &ObjectMgr::LoadCreatureRespawnTimes, "pack_groups creatures");
+    loader.AddTask("gameobjects",               "Loading Gameobject Data...", sObjectMgr, &ObjectMgr::LoadGameobjects, "dbc gameobject_template creatures");
+    loader.AddTask("gameobject_respawn",        "Loading Gameobject Respawn Data...", sObjectMgr, &ObjectMgr::LoadGameobjectRespawnTimes, "creature_respawn gameobjects");
+    loader.AddTask("pools",                     "Loading Objects Pooling Data...", sPoolMgr, &PoolManager::LoadFromDB, "creatures gameobjects");
+    loader.AddTask("game_events",               "Loading Game Event Data...", sGameEventMgr, &GameEventMgr::LoadFromDB, "dbc creature_addon gameobjects pools");
+    loader.AddTask("weather",                   "Loading Weather Data...", sObjectMgr, &ObjectMgr::LoadWeatherZoneChances, "dbc");
+
+    loader.AddTask("quests",                    "Loading Quests...", sObjectMgr, &ObjectMgr::LoadQuests, "dbc spell_data item_template creature_template gameobject_template creatures gameobjects");
+    loader.AddTask("quest_poi",                 "Loading Quest POI...", sObjectMgr, &ObjectMgr::LoadQuestPOI, "quests");
+    loader.AddTask("quest_relations",           "Loading Quests Relations...", sObjectMgr, &ObjectMgr::LoadQuestRelations, "quests game_events");
+    loader.AddTask("npc_spellclick_spells",     "Loading UNIT_NPC_FLAG_SPELLCLICK Data...", sObjectMgr, &ObjectMgr::LoadNPCSpellClickSpells, "spell_data creature_template quests");
+    loader.AddTask("spell_area",                "Loading SpellArea Data...", sSpellMgr, &SpellMgr::LoadSpellAreas, "spell_data quests");
+    loader.AddTask("areatrigger_teleport",      "Loading AreaTrigger definitions...", sObjectMgr, &ObjectMgr::LoadAreaTriggerTeleports, "dbc item_template quests");
+    loader.AddTask("areatrigger_involvedrelation", "Loading Quest Area Triggers...", sObjectMgr, &ObjectMgr::LoadQuestAreaTriggers, "dbc quests");
+    loader.AddTask("areatrigger_tavern",        "Loading Tavern Area Triggers...", sObjectMgr, &ObjectMgr::LoadTavernAreaTriggers, "dbc");
+    loader.AddTask("areatrigger_scripts",       "Loading AreaTrigger script names...", sObjectMgr, &ObjectMgr::LoadAreaTriggerScripts, "dbc script_names");
+    loader.AddTask("event_id_scripts",          "Loading event id script names...", sObjectMgr, &ObjectMgr::LoadEventIdScripts, "dbc script_names");
+    loader.AddTask("graveyard_zone",            "Loading Graveyard-zone links...", sObjectMgr, &ObjectMgr::LoadGraveyardZones, "dbc");
+    loader.AddTask("spell_target_position",     "Loading Spell target coordinates...", sSpellMgr, &SpellMgr::LoadSpellTargetPositions, "dbc spell_data");
+    loader.AddTask("spell_pet_auras",           "Loading spell pet auras...", sSpellMgr, &SpellMgr::LoadSpellPetAuras, "dbc spell_data");
+    loader.AddTask("player_info",               "Loading Player Create Info & Level Stats...", sObjectMgr, &ObjectMgr::LoadPlayerInfo, "dbc spell_data item_template");
+    loader.AddTask("exploration_basexp",        "Loading Exploration BaseXP Data...", sObjectMgr, &ObjectMgr::LoadExplorationBaseXP);
+    loader.AddTask("pet_name_generation",       "Loading Pet Name Parts...", sObjectMgr, &ObjectMgr::LoadPetNames);
+    loader.AddTask("character_db_cleanup",      "Cleaning character database...", &CharacterDatabaseCleaner::CleanDatabase, "dbc spell_data gameobject_respawn");
+    loader.AddTask("pet_number",                "Loading the max pet number...", sObjectMgr, &ObjectMgr::LoadPetNumber);
+    loader.AddTask("pet_levelstats",            "Loading pet level stats...", sObjectMgr, &ObjectMgr::LoadPetLevelInfo, "creature_template");
+    loader.AddTask("corpses",                   "Loading Player Corpses...", sObjectMgr, &ObjectMgr::LoadCorpses, "dbc gameobjects");
+    loader.AddTask("mail_level_reward",         "Loading Player level dependent mail rewards...", sObjectMgr, &ObjectMgr::LoadMailLevelRewards, "dbc creature_template");
+
+    loader.AddTask("loot_creature",             "Loading creature loot templates...", &LoadLootTemplates_Creature, "quests");
+    loader.AddTask("loot_fishing",              "Loading fishing loot templates...", &LoadLootTemplates_Fishing, "quests");
+    loader.AddTask("loot_gameobject",           "Loading gameobject loot templates...", &LoadLootTemplates_Gameobject, "quests");
+    loader.AddTask("loot_item",                 "Loading item loot templates...", &LoadLootTemplates_Item, "quests");
+    loader.AddTask("loot_mail",                 "Loading mail loot templates...", &LoadLootTemplates_Mail, "quests");
+    loader.AddTask("loot_milling",              "Loading milling loot templates...", &LoadLootTemplates_Milling, "quests");
+    loader.AddTask("loot_pickpocketing",        "Loading pickpocketing loot templates...", &LoadLootTemplates_Pickpocketing, "quests");
+    loader.AddTask("loot_skinning",             "Loading skinning loot templates...", &LoadLootTemplates_Skinning, "quests");
+    loader.AddTask("loot_disenchant",           "Loading disenchant loot templates...", &LoadLootTemplates_Disenchant, "quests");
+    loader.AddTask("loot_prospecting",          "Loading prospecting loot templates...", &LoadLootTemplates_Prospecting, "quests");
+    loader.AddTask("loot_spell",                "Loading spell loot templates...", &LoadLootTemplates_Spell, "quests");
+    loader.AddTask("loot_reference",            "Loading reference loot templates...", &LoadLootTemplates_Reference,
+        "loot_creature loot_fishing loot_gameobject loot_item loot_mail loot_milling loot_pickpocketing loot_skinning loot_disenchant loot_prospecting loot_spell");
+
+    loader.AddTask("skill_discovery_template",  "Loading Skill Discovery Table...", &LoadSkillDiscoveryTable, "dbc spell_data");
+    loader.AddTask("skill_extra_item_template", "Loading Skill Extra Item Table...", &LoadSkillExtraItemTable, "dbc spell_data");
+    loader.AddTask("skill_fishing_base_level",  "Loading Skill Fishing base level requirements...", sObjectMgr, &ObjectMgr::LoadFishingBaseSkillLevel, "dbc");
+    loader.AddTask("achievements",              "Loading Achievements...", &LoadAchievementData, "dbc locales item_template creature_template quests");
+    loader.AddTask("character_achievement",     "Loading Completed Achievements...", sAchievementMgr, &AchievementGlobalMgr::LoadCompletedAchievements, "achievements character_db_cleanup");
+
+    ///- Load dynamic data tables from the database
+    loader.AddTask("auctions",                  "Loading Auctions...", &LoadAuctionData, "item_template character_achievement");
+    loader.AddTask("guilds",                    "Loading Guilds...", sObjectMgr, &ObjectMgr::LoadGuilds, "dbc auctions");
+    loader.AddTask("arena_teams",               "Loading ArenaTeams...", sObjectMgr, &ObjectMgr::LoadArenaTeams, "guilds");
+    loader.AddTask("groups",                    "Loading Groups...", sObjectMgr, &ObjectMgr::LoadGroups, "pack_groups arena_teams");
+    loader.AddTask("reserved_name",             "Loading ReservedNames...", sObjectMgr, &ObjectMgr::LoadReservedPlayersNames);
+    loader.AddTask("gameobject_for_quests",     "Loading GameObjects for quests...", sObjectMgr, &ObjectMgr::LoadGameObjectForQuests, "gameobject_template quests loot_gameobject");
+    loader.AddTask("battlemaster_entry",        "Loading BattleMasters...", sBattleGroundMgr, &BattleGroundMgr::LoadBattleMastersEntry, "dbc creature_template");
+    loader.AddTask("battleground_events",       "Loading BattleGround event indexes...", sBattleGroundMgr, &BattleGroundMgr::LoadBattleEventIndexes, "dbc creatures gameobjects");
+    loader.AddTask("game_tele",                 "Loading GameTeleports...", sObjectMgr, &ObjectMgr::LoadGameTele, "dbc");
+    loader.AddTask("npc_gossip",                "Loading Npc Text Id...", sObjectMgr, &ObjectMgr::LoadNpcTextId, "creatures npc_text");
+
+    // script tables are checked for existed creatures, gameobjects, items, quests and spells
+    loader.AddTask("gossip_scripts",            "Loading Gossip scripts...", sObjectMgr, &ObjectMgr::LoadGossipScripts, "quests");
+    loader.AddTask("gossip_menu",               "Loading Gossip menus...", sObjectMgr, &ObjectMgr::LoadGossipMenu, "npc_text gossip_scripts");
+    loader.AddTask("gossip_menu_option",        "Loading Gossip menu options...", sObjectMgr, &ObjectMgr::LoadGossipMenuItems, "locales gossip_menu");
+    loader.AddTask("npc_vendor",                "Loading Vendors...", sObjectMgr, &ObjectMgr::LoadVendors, "creature_template item_template");
+    loader.AddTask("npc_trainer",               "Loading Trainers...", sObjectMgr, &ObjectMgr::LoadTrainerSpell, "spell_data creature_template");
+    loader.AddTask("creature_movement_scripts", "Loading Waypoint scripts...", sObjectMgr, &ObjectMgr::LoadCreatureMovementScripts, "quests");
+    loader.AddTask("creature_movement",         "Loading Waypoints...", sWaypointMgr, &WaypointManager::Load, "creatures creature_movement_scripts groups");
+    loader.AddTask("gm_tickets",                "Loading GM tickets...", sTicketMgr, &GMTicketMgr::LoadGMTickets);
+
+    ///- Handle outdated emails (delete/return)
+    loader.AddTask("return_old_mails",          "Returning old mails...", &ReturnOldMails, "item_template creature_movement");
+
+    loader.AddTask("quest_start_scripts",       "Loading Quest Start Scripts...", sObjectMgr, &ObjectMgr::LoadQuestStartScripts, "quests");
+    loader.AddTask("quest_end_scripts",         "Loading Quest End Scripts...", sObjectMgr, &ObjectMgr::LoadQuestEndScripts, "quests");
+    loader.AddTask("spell_scripts",             "Loading Spell Scripts...", sObjectMgr, &ObjectMgr::LoadSpellScripts, "quests");
+    loader.AddTask("gameobject_scripts",        "Loading GameObject Scripts...", sObjectMgr, &ObjectMgr::LoadGameObjectScripts, "quests");
+    loader.AddTask("event_scripts",             "Loading Event Scripts...", sObjectMgr, &ObjectMgr::LoadEventScripts, "quests");
+    loader.AddTask("db_script_string",          "Loading Scripts text locales...", sObjectMgr, &ObjectMgr::LoadDbScriptStrings,
+        "achievements gossip_scripts creature_movement_scripts quest_start_scripts quest_end_scripts spell_scripts gameobject_scripts event_scripts");
+
+    loader.AddTask("creature_ai_texts",         "Loading CreatureEventAI Texts...", &LoadCreatureEventAITexts, "db_script_string");
+    loader.AddTask("creature_ai_summons",       "Loading CreatureEventAI Summons...", &LoadCreatureEventAISummons);
+    loader.AddTask("creature_ai_scripts",       "Loading CreatureEventAI Scripts...", sEventAIMgr, &CreatureEventAIMgr::LoadCreatureEventAI_Scripts,
+        "spell_data creature_template creature_ai_texts creature_ai_summons");
+
+    return loader.Run(getConfig(CONFIG_UINT32_STARTUP_LOAD_THREADS));
+}
+
 void World::DetectDBCLang()
 {
     uint32 m_lang_confid = sConfig.GetIntDefault("DBC.Locale", 255);
@@ -1455,6 +1379,9 @@ void World::Update(uint32 diff)
         sBattleGroundMgr.Update(diff);
     }
 
+    ///- Autosave players in turn with limits per tick
+    sPlayerSaveScheduler.Update();
+
     ///- Delete all characters which have been deleted X days before
     if (m_timers[WUPDATE_DELETECHARS].Passed())
     {
@@ -1489,6 +1416,9 @@ void World::Update(uint32 diff)
     // update the instance reset times
     sInstanceSaveMgr.Update();
 
+    // return or delete next part of expired mails
+    sObjectMgr.UpdateOldMails();
+
     // And last, but not least handle the issued cli commands
     ProcessCliCommands();
 }
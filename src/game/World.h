@@ -182,6 +182,11 @@ enum eConfigUInt32Values
     CONFIG_UINT32_CHARDELETE_KEEP_DAYS,
     CONFIG_UINT32_CHARDELETE_METHOD,
     CONFIG_UINT32_CHARDELETE_MIN_LEVEL,
+    CONFIG_UINT32_PATHFINDING_MAX_NODES,
+    CONFIG_UINT32_PATHFINDING_CACHE_SIZE,
+    CONFIG_UINT32_STARTUP_LOAD_THREADS,
+    CONFIG_UINT32_SAVE_MAX_PER_TICK,
+    CONFIG_UINT32_SAVE_MAX_STATEMENTS_PER_TICK,
     CONFIG_UINT32_VALUE_COUNT
 };
 
@@ -319,6 +324,7 @@ enum eConfigBoolValues
     CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT,
     CONFIG_BOOL_CLEAN_CHARACTER_DB,
     CONFIG_BOOL_VMAP_INDOOR_CHECK,
+    CONFIG_BOOL_PATHFINDING_ENABLED,
     CONFIG_BOOL_VALUE_COUNT
 };
 
@@ -659,6 +665,8 @@ class World
         LocaleConstant m_defaultDbcLocale;                     // from config for one from loaded DBC locales
         uint32 m_availableDbcLocaleMask;                       // by loaded DBC
         void DetectDBCLang();
+        void LoadDBCData();
+        bool LoadStartupData();
         bool m_allowMovement;
         std::string m_motd;
         std::string m_dataPath;
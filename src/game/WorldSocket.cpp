@@ -42,6 +42,7 @@
 #include "WorldSocketMgr.h"
 #include "Log.h"
 #include "DBCStores.h"
+#include "PacketCapture.h"
 
 #if defined( __GNUC__ )
 #pragma pack(1)
@@ -99,6 +100,7 @@ struct ClientPktHeader
 WorldSocket::WorldSocket (void) :
 WorldHandler (),
 m_Session (0),
+m_AccountId (0),
 m_RecvWPct (0),
 m_RecvPct (),
 m_Header (sizeof (ClientPktHeader)),
@@ -166,6 +168,7 @@ int WorldSocket::SendPacket (const WorldPacket& pct)
 
     // Dump outgoing packet.
     sLog.outWorldPacketDump(uint32(get_handle()), pct.GetOpcode(), LookupOpcodeName(pct.GetOpcode()), &pct, false);
+    sPacketCapture.Capture(uint32(get_handle()), m_AccountId, pct, pct.GetOpcode(), PACKET_CAPTURE_SERVER);
 
     ServerPktHeader header(pct.size()+2, pct.GetOpcode());
     m_Crypt.EncryptSend ((uint8*)header.header, header.getHeaderLength());
@@ -674,6 +677,7 @@ int WorldSocket::ProcessIncoming (WorldPacket* new_pct)
 
     // Dump received packet.
     sLog.outWorldPacketDump(uint32(get_handle()), new_pct->GetOpcode(), LookupOpcodeName(new_pct->GetOpcode()), new_pct, true);
+    sPacketCapture.Capture(uint32(get_handle()), m_AccountId, *new_pct, new_pct->GetOpcode(), PACKET_CAPTURE_CLIENT);
 
     try
     {
@@ -942,6 +946,8 @@ int WorldSocket::HandleAuthSession (WorldPacket& recvPacket)
                             address.c_str (),
                             safe_account.c_str ());
 
+    m_AccountId = id;
+
     // NOTE ATM the socket is single-threaded, have this in mind ...
     ACE_NEW_RETURN (m_Session, WorldSession (id, this, AccountTypes(security), expansion, mutetime, locale), -1);
 
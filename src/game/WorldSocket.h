@@ -192,6 +192,9 @@ class WorldSocket : protected WorldHandler
         /// Session to which received packets are routed
         WorldSession* m_Session;
 
+        /// Account of authenticated session, for packet capture without m_SessionLock
+        uint32 m_AccountId;
+
         /// here are stored the fragments of the received data
         WorldPacket* m_RecvWPct;
 
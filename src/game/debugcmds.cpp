@@ -32,6 +32,8 @@
 #include "ObjectMgr.h"
 #include "ObjectGuid.h"
 #include "SpellMgr.h"
+#include "PacketCapture.h"
+#include "Config/Config.h"
 
 bool ChatHandler::HandleDebugSendSpellFailCommand(char* args)
 {
@@ -1086,3 +1088,158 @@ bool ChatHandler::HandleDebugSpellModsCommand(char* args)
 
     return true;
 }
+
+bool ChatHandler::HandleDebugCaptureCommand(char* /*args*/)
+{
+    PacketCaptureStats stats = sPacketCapture.GetStats();
+
+    if (sPacketCapture.IsActive())
+        PSendSysMessage("Packet capture to %s: " UI64FMTD " packets, " UI64FMTD " dropped, " UI64FMTD " bytes written, %u bytes pending.",
+            sPacketCapture.GetFilename().c_str(), stats.packets, stats.dropped, stats.bytesWritten, stats.pendingBytes);
+    else
+        SendSysMessage("Packet capture not active.");
+
+    PacketCapture::FilterSet opcodes = sPacketCapture.GetOpcodeFilter();
+    if (opcodes.empty())
+        SendSysMessage("Opcode filter: all opcodes.");
+    else
+    {
+        SendSysMessage("Opcode filter:");
+        for(PacketCapture::FilterSet::const_iterator itr = opcodes.begin(); itr != opcodes.end(); ++itr)
+            PSendSysMessage("  %s (0x%.4X)", LookupOpcodeName(*itr), *itr);
+    }
+
+    PacketCapture::FilterSet accounts = sPacketCapture.GetAccountFilter();
+    if (accounts.empty())
+        SendSysMessage("Account filter: all accounts.");
+    else
+    {
+        std::ostringstream ss;
+        for(PacketCapture::FilterSet::const_iterator itr = accounts.begin(); itr != accounts.end(); ++itr)
+            ss << " " << *itr;
+        PSendSysMessage("Account filter:%s", ss.str().c_str());
+    }
+
+    return true;
+}
+
+bool ChatHandler::HandleDebugCaptureStartCommand(char* args)
+{
+    if (sPacketCapture.IsActive())
+    {
+        PSendSysMessage("Packet capture to %s already active.", sPacketCapture.GetFilename().c_str());
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    std::string filename;
+    if (char* nameStr = ExtractQuotedOrLiteralArg(&args))
+    {
+        filename = nameStr;
+
+        // only files in logs directory
+        if (filename.find_first_of("/\\") != std::string::npos || filename.find("..") != std::string::npos)
+        {
+            SendSysMessage("Wrong capture file name, expected file name without path.");
+            SetSentErrorMessage(true);
+            return false;
+        }
+    }
+    else
+        filename = "packets_" + Log::GetTimestampStr() + ".cap";
+
+    std::string logsDir = sConfig.GetStringDefault("LogsDir", "");
+    if (!logsDir.empty() && logsDir[logsDir.size() - 1] != '/' && logsDir[logsDir.size() - 1] != '\\')
+        logsDir += "/";
+
+    filename = logsDir + filename;
+
+    if (!sPacketCapture.Start(filename))
+    {
+        PSendSysMessage("Can't open packet capture file %s.", filename.c_str());
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    PSendSysMessage("Packet capture to %s started.", filename.c_str());
+    return true;
+}
+
+bool ChatHandler::HandleDebugCaptureStopCommand(char* /*args*/)
+{
+    if (!sPacketCapture.IsActive())
+    {
+        SendSysMessage("Packet capture not active.");
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    std::string filename = sPacketCapture.GetFilename();
+    PacketCaptureStats stats = sPacketCapture.GetStats();
+
+    sPacketCapture.Stop();
+
+    PSendSysMessage("Packet capture to %s stopped, " UI64FMTD " packets captured, " UI64FMTD " dropped.",
+        filename.c_str(), stats.packets, stats.dropped);
+    return true;
+}
+
+bool ChatHandler::HandleDebugCaptureOpcodeCommand(char* args)
+{
+    if (!*args)
+    {
+        sPacketCapture.ClearOpcodeFilter();
+        SendSysMessage("Opcode filter cleared, all opcodes captured.");
+        return true;
+    }
+
+    char* opcodeStr = ExtractLiteralArg(&args);
+    if (!opcodeStr)
+        return false;
+
+    // opcode number (decimal or hex) or name
+    uint32 opcode = NUM_MSG_TYPES;
+    if (isdigit(*opcodeStr))
+        opcode = uint32(strtoul(opcodeStr, NULL, 0));
+    else
+    {
+        for(uint32 i = 0; i < NUM_MSG_TYPES; ++i)
+        {
+            if (stricmp(opcodeStr, LookupOpcodeName(i)) == 0)
+            {
+                opcode = i;
+                break;
+            }
+        }
+    }
+
+    if (opcode >= NUM_MSG_TYPES)
+    {
+        PSendSysMessage("Unknown opcode %s.", opcodeStr);
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    bool added = sPacketCapture.ToggleOpcodeFilter(opcode);
+    PSendSysMessage("Opcode %s (0x%.4X) %s capture filter.", LookupOpcodeName(opcode), opcode, added ? "added to" : "removed from");
+    return true;
+}
+
+bool ChatHandler::HandleDebugCaptureAccountCommand(char* args)
+{
+    if (!*args)
+    {
+        sPacketCapture.ClearAccountFilter();
+        SendSysMessage("Account filter cleared, all accounts captured.");
+        return true;
+    }
+
+    std::string accountName;
+    uint32 accountId = ExtractAccountId(&args, &accountName);
+    if (!accountId)
+        return false;
+
+    bool added = sPacketCapture.ToggleAccountFilter(accountId);
+    PSendSysMessage("Account %s (Id: %u) %s capture filter.", accountName.c_str(), accountId, added ? "added to" : "removed from");
+    return true;
+}
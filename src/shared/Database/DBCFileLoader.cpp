@@ -22,52 +22,66 @@
 
 #include "DBCFileLoader.h"
 
+#include <ace/Mem_Map.h>
+
+#define DBC_HEADER_SIZE 20
+
 DBCFileLoader::DBCFileLoader()
 {
     data = NULL;
     fieldsOffset = NULL;
+    fileMap = NULL;
 }
 
 bool DBCFileLoader::Load(const char *filename, const char *fmt)
 {
+    Unload();
 
-    uint32 header;
-    if(data)
+    // private mapping: pages shared with OS file cache until changed by some data fixes at load
+    fileMap = new ACE_Mem_Map;
+    if (fileMap->map(filename, static_cast<size_t>(-1), O_RDONLY, ACE_DEFAULT_FILE_PERMS, PROT_RDWR, ACE_MAP_PRIVATE) != 0)
     {
-        delete [] data;
-        data=NULL;
+        delete fileMap;
+        fileMap = NULL;
+        return false;
     }
 
-    FILE * f=fopen(filename,"rb");
-    if(!f)return false;
+    unsigned char* base = (unsigned char*)fileMap->addr();
+    size_t fileSize = fileMap->size();
 
-    if(fread(&header,4,1,f)!=1)                             // Number of records
+    if (fileSize < DBC_HEADER_SIZE)
+    {
+        Unload();
         return false;
+    }
 
+    uint32 header;
+    memcpy(&header, base, 4);
     EndianConvert(header);
-    if(header!=0x43424457)
-        return false;                                       //'WDBC'
-
-    if(fread(&recordCount,4,1,f)!=1)                        // Number of records
+    if(header!=0x43424457)                                  //'WDBC'
+    {
+        Unload();
         return false;
+    }
 
+    memcpy(&recordCount, base + 4, 4);                      // Number of records
     EndianConvert(recordCount);
 
-    if(fread(&fieldCount,4,1,f)!=1)                         // Number of fields
-        return false;
-
+    memcpy(&fieldCount, base + 8, 4);                       // Number of fields
     EndianConvert(fieldCount);
 
-    if(fread(&recordSize,4,1,f)!=1)                         // Size of a record
-        return false;
-
+    memcpy(&recordSize, base + 12, 4);                      // Size of a record
     EndianConvert(recordSize);
 
-    if(fread(&stringSize,4,1,f)!=1)                         // String size
-        return false;
-
+    memcpy(&stringSize, base + 16, 4);                      // String size
     EndianConvert(stringSize);
 
+    if (fieldCount == 0 || fileSize < DBC_HEADER_SIZE + uint64(recordSize)*recordCount + stringSize)
+    {
+        Unload();
+        return false;
+    }
+
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
     for(uint32 i = 1; i < fieldCount; i++)
@@ -79,22 +93,30 @@ bool DBCFileLoader::Load(const char *filename, const char *fmt)
             fieldsOffset[i] += 4;
     }
 
-    data = new unsigned char[recordSize*recordCount+stringSize];
+    data = base + DBC_HEADER_SIZE;
     stringTable = data + recordSize*recordCount;
-
-    if(fread(data,recordSize*recordCount+stringSize,1,f)!=1)
-        return false;
-
-    fclose(f);
     return true;
 }
 
-DBCFileLoader::~DBCFileLoader()
+void DBCFileLoader::Unload()
 {
-    if(data)
-        delete [] data;
+    if(fileMap)
+    {
+        fileMap->close();
+        delete fileMap;
+        fileMap = NULL;
+    }
+    data = NULL;
     if(fieldsOffset)
+    {
         delete [] fieldsOffset;
+        fieldsOffset = NULL;
+    }
+}
+
+DBCFileLoader::~DBCFileLoader()
+{
+    Unload();
 }
 
 DBCFileLoader::Record DBCFileLoader::getRecord(size_t id)
@@ -218,13 +240,10 @@ char* DBCFileLoader::AutoProduceData(const char* format, uint32& records, char**
     return dataTable;
 }
 
-char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
+bool DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
 {
     if(strlen(format)!=fieldCount)
-        return NULL;
-
-    char* stringPool= new char[stringSize];
-    memcpy(stringPool,stringTable,stringSize);
+        return false;
 
     uint32 offset=0;
 
@@ -247,8 +266,8 @@ char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
                 char** slot = (char**)(&dataTable[offset]);
                 if(!*slot || !**slot)
                 {
-                    const char * st = getRecord(y).getString(x);
-                    *slot=stringPool+(st-(const char*)stringTable);
+                    // resolved in place, string table is part of mapped file
+                    *slot=(char*)getRecord(y).getString(x);
                 }
                 offset+=sizeof(char*);
                 break;
@@ -262,5 +281,63 @@ char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
         }
     }
 
-    return stringPool;
+    return true;
+}
+
+bool DBCFileLoader::IsDirectlyMappable(const char* format) const
+{
+#if MANGOS_ENDIAN == MANGOS_BIGENDIAN
+    return false;                                           // values must be converted
+#else
+    if(strlen(format)!=fieldCount)
+        return false;
+
+    // skipped fields and string pointers make structure layout different from file record
+    for(uint32 x=0; format[x]; ++x)
+        if(format[x] != FT_INT && format[x] != FT_FLOAT && format[x] != FT_IND && format[x] != FT_BYTE)
+            return false;
+
+    // also false at alignment padding in structure, records must be 4 bytes aligned in file
+    return GetFormatRecordSize(format) == recordSize && recordSize % 4 == 0;
+#endif
+}
+
+char** DBCFileLoader::AutoProduceIndex(const char* format, uint32& records)
+{
+    typedef char * ptr;
+    if(strlen(format)!=fieldCount)
+        return NULL;
+
+    int32 i;
+    GetFormatRecordSize(format,&i);
+
+    char** indexTable;
+    if(i>=0)
+    {
+        uint32 maxi=0;
+        //find max index
+        for(uint32 y=0;y<recordCount;y++)
+        {
+            uint32 ind=getRecord(y).getUInt (i);
+            if(ind>maxi)maxi=ind;
+        }
+
+        ++maxi;
+        records=maxi;
+        indexTable=new ptr[maxi];
+        memset(indexTable,0,maxi*sizeof(ptr));
+
+        for(uint32 y=0;y<recordCount;y++)
+            indexTable[getRecord(y).getUInt(i)]=(char*)(data + y*recordSize);
+    }
+    else
+    {
+        records = recordCount;
+        indexTable = new ptr[recordCount];
+
+        for(uint32 y=0;y<recordCount;y++)
+            indexTable[y]=(char*)(data + y*recordSize);
+    }
+
+    return indexTable;
 }
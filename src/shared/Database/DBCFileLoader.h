@@ -22,6 +22,8 @@
 #include "Utilities/ByteConverter.h"
 #include <cassert>
 
+class ACE_Mem_Map;
+
 enum
 {
     FT_NA='x',                                              //not used or unknown, 4 byte size
@@ -41,6 +43,7 @@ class DBCFileLoader
         DBCFileLoader();
         ~DBCFileLoader();
 
+        // file content is memory mapped with private copy-on-write pages and used in place
         bool Load(const char *filename, const char *fmt);
 
         class Record
@@ -92,9 +95,17 @@ class DBCFileLoader
         uint32 GetOffset(size_t id) const { return (fieldsOffset != NULL && id < fieldCount) ? fieldsOffset[id] : 0; }
         bool IsLoaded() {return (data!=NULL);}
         char* AutoProduceData(const char* fmt, uint32& count, char**& indexTable);
-        char* AutoProduceStrings(const char* fmt, char* dataTable);
+        // set string fields of dataTable to strings in mapped file, loader must be alive while strings used
+        bool AutoProduceStrings(const char* fmt, char* dataTable);
+        // true if file records have same layout as structure for fmt and can be used without copy
+        bool IsDirectlyMappable(const char* fmt) const;
+        // index to records in mapped file, loader must be alive while records used
+        char** AutoProduceIndex(const char* fmt, uint32& count);
         static uint32 GetFormatRecordSize(const char * format, int32 * index_pos = NULL);
     private:
+        void Unload();
+
+        ACE_Mem_Map *fileMap;
 
         uint32 recordSize;
         uint32 recordCount;
@@ -24,7 +24,7 @@
 template<class T>
 class DBCStorage
 {
-    typedef std::list<char*> StringPoolList;
+    typedef std::list<DBCFileLoader*> FileList;
     public:
         explicit DBCStorage(const char *f) : nCount(0), fieldCount(0), fmt(f), indexTable(NULL), m_dataTable(NULL) { }
         ~DBCStorage() { Clear(); }
@@ -36,18 +36,31 @@ class DBCStorage
 
         bool Load(char const* fn)
         {
-            DBCFileLoader dbc;
+            DBCFileLoader* dbc = new DBCFileLoader;
             // Check if load was sucessful, only then continue
-            if(!dbc.Load(fn, fmt))
+            if(!dbc->Load(fn, fmt))
+            {
+                delete dbc;
                 return false;
+            }
+
+            fieldCount = dbc->GetCols();
+
+            // mapped file kept while store used, records and strings point into it
+            m_fileList.push_back(dbc);
 
-            fieldCount = dbc.GetCols();
+            // records with same layout as structure used directly
+            if(dbc->IsDirectlyMappable(fmt))
+            {
+                indexTable = (T**)dbc->AutoProduceIndex(fmt,nCount);
+                return indexTable!=NULL;
+            }
 
             // load raw non-string data
-            m_dataTable = (T*)dbc.AutoProduceData(fmt,nCount,(char**&)indexTable);
+            m_dataTable = (T*)dbc->AutoProduceData(fmt,nCount,(char**&)indexTable);
 
             // load strings from dbc data
-            m_stringPoolList.push_back(dbc.AutoProduceStrings(fmt,(char*)m_dataTable));
+            dbc->AutoProduceStrings(fmt,(char*)m_dataTable);
 
             // error in dbc file at loading if NULL
             return indexTable!=NULL;
@@ -59,19 +72,33 @@ class DBCStorage
             if(!indexTable)
                 return false;
 
-            DBCFileLoader dbc;
+            // strings in directly used records are offsets in main file string table
+            if(!m_dataTable)
+                return true;
+
+            DBCFileLoader* dbc = new DBCFileLoader;
             // Check if load was successful, only then continue
-            if(!dbc.Load(fn, fmt))
+            if(!dbc->Load(fn, fmt))
+            {
+                delete dbc;
                 return false;
+            }
 
             // load strings from another locale dbc data
-            m_stringPoolList.push_back(dbc.AutoProduceStrings(fmt,(char*)m_dataTable));
+            m_fileList.push_back(dbc);
+            dbc->AutoProduceStrings(fmt,(char*)m_dataTable);
 
             return true;
         }
 
         void Clear()
         {
+            while(!m_fileList.empty())
+            {
+                delete m_fileList.front();
+                m_fileList.pop_front();
+            }
+
             if (!indexTable)
                 return;
 
@@ -79,12 +106,6 @@ class DBCStorage
             indexTable = NULL;
             delete[] ((char*)m_dataTable);
             m_dataTable = NULL;
-
-            while(!m_stringPoolList.empty())
-            {
-                delete[] m_stringPoolList.front();
-                m_stringPoolList.pop_front();
-            }
             nCount = 0;
         }
 
@@ -96,7 +117,7 @@ class DBCStorage
         char const* fmt;
         T** indexTable;
         T* m_dataTable;
-        StringPoolList m_stringPoolList;
+        FileList m_fileList;
 };
 
 #endif
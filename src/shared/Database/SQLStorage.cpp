@@ -49,6 +49,20 @@ SQLStorage sItemStorage(ItemPrototypesrcfmt, ItemPrototypedstfmt, "entry","item_
 SQLStorage sPageTextStore(PageTextfmt,"entry","page_text");
 SQLStorage sInstanceTemplate(InstanceTemplatesrcfmt, InstanceTemplatedstfmt, "map","instance_template");
 
+std::string SQLStorage::m_cacheDir;
+
+#define SQLSTORAGE_CACHE_MAGIC   0x43515353                 // 'SSQC'
+#define SQLSTORAGE_CACHE_VERSION 1
+
+static uint32 CacheHash(uint8 const* data, size_t size)
+{
+    // FNV-1a
+    uint32 hash = 2166136261U;
+    for(size_t i = 0; i < size; ++i)
+        hash = (hash ^ data[i]) * 16777619U;
+    return hash;
+}
+
 void SQLStorage::EraseEntry(uint32 id)
 {
     uint32 offset=0;
@@ -93,6 +107,135 @@ void SQLStorage::Free ()
     delete [] data;
 }
 
+std::string SQLStorage::GetCacheFileName() const
+{
+    return m_cacheDir + table + ".snapshot";
+}
+
+bool SQLStorage::GetTableChecksum(uint64& checksum) const
+{
+#ifdef DO_POSTGRESQL
+    // no cheap content checksum, always load from DB
+    return false;
+#else
+    // content checksum calculated at DB side, much faster than select and parse all rows
+    QueryResult* result = WorldDatabase.PQuery("CHECKSUM TABLE %s", table);
+    if (!result)
+        return false;
+
+    Field* fields = result->Fetch();
+    bool found = !fields[1].IsNULL();
+    checksum = fields[1].GetUInt64();
+    delete result;
+    return found;
+#endif
+}
+
+bool SQLStorage::ReadCache(ByteBuffer& buffer, uint64 checksum, uint32& maxEntry, uint32& recordCount) const
+{
+    std::string filename = GetCacheFileName();
+    FILE* f = fopen(filename.c_str(), "rb");
+    if (!f)
+        return false;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    if (size <= 0)
+    {
+        fclose(f);
+        return false;
+    }
+
+    buffer.resize(size);
+    bool readOk = fread((void*)buffer.contents(), size, 1, f) == 1;
+    fclose(f);
+
+    if (!readOk)
+        return false;
+
+    try
+    {
+        std::string fileTable, fileFormat;
+        uint32 magic = buffer.read<uint32>();
+        uint32 version = buffer.read<uint32>();
+        if (magic != SQLSTORAGE_CACHE_MAGIC || version != SQLSTORAGE_CACHE_VERSION)
+        {
+            sLog.outDetail("Snapshot file %s has unsupported format, loading table from database.", filename.c_str());
+            return false;
+        }
+
+        buffer >> fileTable >> fileFormat;
+        uint64 fileChecksum = buffer.read<uint64>();
+        maxEntry = buffer.read<uint32>();
+        recordCount = buffer.read<uint32>();
+        uint32 hash = buffer.read<uint32>();
+
+        if (fileTable != table || fileFormat != src_format)
+        {
+            sLog.outDetail("Snapshot file %s created for different table format, loading table from database.", filename.c_str());
+            return false;
+        }
+
+        if (fileChecksum != checksum)
+        {
+            sLog.outDetail("Snapshot file %s is outdated, loading table from database.", filename.c_str());
+            return false;
+        }
+
+        if (hash != CacheHash(buffer.contents() + buffer.rpos(), buffer.size() - buffer.rpos()))
+        {
+            sLog.outError("Snapshot file %s is corrupted, loading table from database.", filename.c_str());
+            return false;
+        }
+    }
+    catch(ByteBufferException&)
+    {
+        sLog.outError("Snapshot file %s is corrupted, loading table from database.", filename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void SQLStorage::WriteCache(ByteBuffer const& rows, uint64 checksum, uint32 maxEntry, uint32 recordCount) const
+{
+    ByteBuffer header;
+    header << uint32(SQLSTORAGE_CACHE_MAGIC);
+    header << uint32(SQLSTORAGE_CACHE_VERSION);
+    header << table;
+    header << src_format;
+    header << uint64(checksum);
+    header << uint32(maxEntry);
+    header << uint32(recordCount);
+    header << uint32(rows.size() ? CacheHash(rows.contents(), rows.size()) : CacheHash(NULL, 0));
+
+    // write to temporary file and replace, not leave partly written file at crash
+    std::string filename = GetCacheFileName();
+    std::string tmpname = filename + ".tmp";
+    FILE* f = fopen(tmpname.c_str(), "wb");
+    if (!f)
+    {
+        sLog.outError("Can't create snapshot file %s for table %s.", tmpname.c_str(), table);
+        return;
+    }
+
+    bool writeOk = fwrite(header.contents(), header.size(), 1, f) == 1;
+    if (writeOk && rows.size())
+        writeOk = fwrite(rows.contents(), rows.size(), 1, f) == 1;
+    writeOk = fclose(f) == 0 && writeOk;
+
+#if PLATFORM == PLATFORM_WINDOWS
+    remove(filename.c_str());                               // rename not replace existed file at Windows
+#endif
+    if (!writeOk || rename(tmpname.c_str(), filename.c_str()) != 0)
+    {
+        sLog.outError("Can't write snapshot file %s for table %s.", filename.c_str(), table);
+        remove(tmpname.c_str());
+    }
+}
+
 void SQLStorage::Load()
 {
     SQLStorageLoader loader;
@@ -21,6 +21,7 @@
 
 #include "Common.h"
 #include "Database/DatabaseEnv.h"
+#include "ByteBuffer.h"
 
 class SQLStorage
 {
@@ -69,7 +70,16 @@ class SQLStorage
         void Free();
 
         void EraseEntry(uint32 id);
+
+        // directory for table snapshot files, empty string disable snapshot use
+        static void SetCacheDirectory(std::string const& dir) { m_cacheDir = dir; }
+        static bool IsCacheEnabled() { return !m_cacheDir.empty(); }
     private:
+        std::string GetCacheFileName() const;
+        bool GetTableChecksum(uint64& checksum) const;
+        bool ReadCache(ByteBuffer& buffer, uint64 checksum, uint32& maxEntry, uint32& recordCount) const;
+        void WriteCache(ByteBuffer const& rows, uint64 checksum, uint32 maxEntry, uint32 recordCount) const;
+
         void init(const char * _entry_field, const char * sqlname)
         {
             entry_field = _entry_field;
@@ -88,6 +98,8 @@ class SQLStorage
         const char *table;
         const char *entry_field;
         //bool HasString;
+
+        static std::string m_cacheDir;
 };
 
 template <class T>
@@ -108,6 +120,11 @@ struct SQLStorageLoaderBase
         template<class V>
             void storeValue(V value, SQLStorage &store, char *p, int x, uint32 &offset);
         void storeValue(char * value, SQLStorage &store, char *p, int x, uint32 &offset);
+
+        template<class R>
+            void storeRow(R &row, SQLStorage &store, char *p);
+        bool LoadFromCache(SQLStorage &store, uint64 checksum);
+        uint32 recordSize(SQLStorage const&store) const;
 };
 
 struct SQLStorageLoader : public SQLStorageLoaderBase<SQLStorageLoader>
@@ -117,9 +117,194 @@ void SQLStorageLoaderBase<T>::storeValue(char * value, SQLStorage &store, char *
     }
 }
 
+// Row source reading fields from query result, optionally copying them to snapshot buffer
+class SQLStorageQueryRow
+{
+    public:
+        SQLStorageQueryRow(Field* fields, ByteBuffer* cache) : i_fields(fields), i_cache(cache) {}
+
+        uint32 GetEntry() const { return i_fields[0].GetUInt32(); }
+
+        bool GetBool(uint32 x)
+        {
+            bool value = i_fields[x].GetUInt32() > 0;
+            if (i_cache)
+                *i_cache << uint8(value ? 1 : 0);
+            return value;
+        }
+        char GetByte(uint32 x)
+        {
+            char value = (char)i_fields[x].GetUInt8();
+            if (i_cache)
+                *i_cache << uint8(value);
+            return value;
+        }
+        uint32 GetInt(uint32 x)
+        {
+            uint32 value = i_fields[x].GetUInt32();
+            if (i_cache)
+                *i_cache << uint32(value);
+            return value;
+        }
+        float GetFloat(uint32 x)
+        {
+            float value = i_fields[x].GetFloat();
+            if (i_cache)
+                *i_cache << float(value);
+            return value;
+        }
+        char* GetString(uint32 x)
+        {
+            char* value = (char*)i_fields[x].GetString();
+            if (i_cache)
+            {
+                // NULL and empty string can be converted differently by loaders
+                *i_cache << uint8(value ? 1 : 0);
+                if (value)
+                    i_cache->append(value, strlen(value) + 1);
+            }
+            return value;
+        }
+
+    private:
+        Field* i_fields;
+        ByteBuffer* i_cache;
+};
+
+// Row source reading fields from snapshot buffer, strings point into buffer
+class SQLStorageCacheRow
+{
+    public:
+        explicit SQLStorageCacheRow(ByteBuffer& buffer) : i_buffer(buffer) {}
+
+        uint32 ReadEntry() { return i_buffer.read<uint32>(); }
+
+        bool GetBool(uint32 /*x*/) { return i_buffer.read<uint8>() != 0; }
+        char GetByte(uint32 /*x*/) { return (char)i_buffer.read<uint8>(); }
+        uint32 GetInt(uint32 /*x*/) { return i_buffer.read<uint32>(); }
+        float GetFloat(uint32 /*x*/) { return i_buffer.read<float>(); }
+        char* GetString(uint32 /*x*/)
+        {
+            if (!i_buffer.read<uint8>())
+                return NULL;
+
+            size_t start = i_buffer.rpos();
+            size_t end = start;
+            while (i_buffer.read<uint8>(end) != 0)          // throw at unterminated string
+                ++end;
+            i_buffer.rpos(end + 1);
+            return (char*)(i_buffer.contents() + start);
+        }
+
+    private:
+        ByteBuffer& i_buffer;
+};
+
+template<class T>
+template<class R>
+void SQLStorageLoaderBase<T>::storeRow(R &row, SQLStorage &store, char *p)
+{
+    uint32 offset = 0;
+    for(uint32 x = 0; x < store.iNumFields; x++)
+        switch(store.src_format[x])
+        {
+            case FT_LOGIC:
+                storeValue(row.GetBool(x), store, p, x, offset); break;
+            case FT_BYTE:
+                storeValue(row.GetByte(x), store, p, x, offset); break;
+            case FT_INT:
+                storeValue(row.GetInt(x), store, p, x, offset); break;
+            case FT_FLOAT:
+                storeValue(row.GetFloat(x), store, p, x, offset); break;
+            case FT_STRING:
+                storeValue(row.GetString(x), store, p, x, offset); break;
+        }
+}
+
+template<class T>
+uint32 SQLStorageLoaderBase<T>::recordSize(SQLStorage const &store) const
+{
+    //get struct size
+    uint32 sc=0;
+    uint32 bo=0;
+    uint32 bb=0;
+    for(uint32 x=0; x< store.iNumFields; x++)
+        if(store.dst_format[x]==FT_STRING)
+            ++sc;
+        else if (store.dst_format[x]==FT_LOGIC)
+            ++bo;
+        else if (store.dst_format[x]==FT_BYTE)
+            ++bb;
+    return (store.iNumFields-sc-bo-bb)*4+sc*sizeof(char*)+bo*sizeof(bool)+bb*sizeof(char);
+}
+
+template<class T>
+bool SQLStorageLoaderBase<T>::LoadFromCache(SQLStorage &store, uint64 checksum)
+{
+    ByteBuffer buffer;
+    uint32 maxi = 0;
+    uint32 recordCount = 0;
+    if (!store.ReadCache(buffer, checksum, maxi, recordCount))
+        return false;
+
+    uint32 recordsize = recordSize(store);
+
+    char** newIndex=new char*[maxi];
+    memset(newIndex,0,maxi*sizeof(char*));
+
+    char * _data= new char[recordCount *recordsize];
+    uint32 count=0;
+
+    try
+    {
+        SQLStorageCacheRow row(buffer);
+        barGoLink bar( recordCount );
+        for(; count < recordCount; ++count)
+        {
+            bar.step();
+            uint32 entry = row.ReadEntry();
+            if (entry >= maxi)
+                throw ByteBufferException(false, buffer.rpos(), sizeof(uint32), buffer.size());
+
+            char *p=(char*)&_data[recordsize*count];
+            newIndex[entry]=p;
+            storeRow(row, store, p);
+        }
+    }
+    catch(ByteBufferException&)
+    {
+        // checksum match but content broken, free already converted strings and load from DB
+        sLog.outError("Snapshot file %s is corrupted, loading table %s from database.", store.GetCacheFileName().c_str(), store.table);
+        store.pIndex = newIndex;
+        store.MaxEntry = maxi;
+        store.data = _data;
+        for(uint32 i = 0; i < maxi; ++i)
+            if (newIndex[i] && newIndex[i] >= &_data[recordsize*count])
+                newIndex[i] = NULL;                         // entry set but row not converted
+        store.Free();
+        store.pIndex = NULL;
+        store.data = NULL;
+        store.MaxEntry = 0;
+        return false;
+    }
+
+    store.RecordCount = recordCount;
+    store.pIndex = newIndex;
+    store.MaxEntry = maxi;
+    store.data = _data;
+
+    sLog.outString("Table %s loaded from snapshot file.", store.table);
+    return true;
+}
+
 template<class T>
 void SQLStorageLoaderBase<T>::Load(SQLStorage &store)
 {
+    uint64 checksum = 0;
+    bool useCache = SQLStorage::IsCacheEnabled() && store.GetTableChecksum(checksum);
+    if (useCache && LoadFromCache(store, checksum))
+        return;
+
     uint32 maxi;
     Field *fields;
     QueryResult *result  = WorldDatabase.PQuery("SELECT MAX(%s) FROM %s", store.entry_field, store.table);
@@ -152,9 +337,6 @@ void SQLStorageLoaderBase<T>::Load(SQLStorage &store)
         return;
     }
 
-    uint32 recordsize = 0;
-    uint32 offset = 0;
-
     if(store.iNumFields != result->GetFieldCount())
     {
         store.RecordCount = 0;
@@ -164,24 +346,17 @@ void SQLStorageLoaderBase<T>::Load(SQLStorage &store)
         exit(1);                                            // Stop server at loading broken or non-compatible table.
     }
 
-    //get struct size
-    uint32 sc=0;
-    uint32 bo=0;
-    uint32 bb=0;
-    for(uint32 x=0; x< store.iNumFields; x++)
-        if(store.dst_format[x]==FT_STRING)
-            ++sc;
-        else if (store.dst_format[x]==FT_LOGIC)
-            ++bo;
-        else if (store.dst_format[x]==FT_BYTE)
-            ++bb;
-    recordsize=(store.iNumFields-sc-bo-bb)*4+sc*sizeof(char*)+bo*sizeof(bool)+bb*sizeof(char);
+    uint32 recordsize = recordSize(store);
 
     char** newIndex=new char*[maxi];
     memset(newIndex,0,maxi*sizeof(char*));
 
     char * _data= new char[store.RecordCount *recordsize];
     uint32 count=0;
+
+    // source values of all rows for snapshot file
+    ByteBuffer cache(useCache ? store.RecordCount * recordsize : 0);
+
     barGoLink bar( store.RecordCount );
     do
     {
@@ -190,21 +365,10 @@ void SQLStorageLoaderBase<T>::Load(SQLStorage &store)
         char *p=(char*)&_data[recordsize*count];
         newIndex[fields[0].GetUInt32()]=p;
 
-        offset=0;
-        for(uint32 x = 0; x < store.iNumFields; x++)
-            switch(store.src_format[x])
-            {
-                case FT_LOGIC:
-                    storeValue((bool)(fields[x].GetUInt32() > 0), store, p, x, offset); break;
-                case FT_BYTE:
-                    storeValue((char)fields[x].GetUInt8(), store, p, x, offset); break;
-                case FT_INT:
-                    storeValue((uint32)fields[x].GetUInt32(), store, p, x, offset); break;
-                case FT_FLOAT:
-                    storeValue((float)fields[x].GetFloat(), store, p, x, offset); break;
-                case FT_STRING:
-                    storeValue((char*)fields[x].GetString(), store, p, x, offset); break;
-            }
+        SQLStorageQueryRow row(fields, useCache ? &cache : NULL);
+        if (useCache)
+            cache << uint32(row.GetEntry());
+        storeRow(row, store, p);
         ++count;
     }while( result->NextRow() );
 
@@ -213,4 +377,7 @@ void SQLStorageLoaderBase<T>::Load(SQLStorage &store)
     store.pIndex = newIndex;
     store.MaxEntry = maxi;
     store.data = _data;
+
+    if (useCache)
+        store.WriteCache(cache, checksum, maxi, count);
 }
@@ -29,9 +29,21 @@
 #include <iostream>
 
 #include "ace/OS_NS_unistd.h"
+#include "ace/OS_NS_time.h"
 
 INSTANTIATE_SINGLETON_1( Log );
 
+// stack buffer for format log output in logging thread, longer output formatted in heap
+#define LOG_FORMAT_BUFFER_SIZE 2048
+// log writer thread sleep between writes queued output
+#define LOG_WRITER_SLEEP       10
+// queued records amount without queue reallocation under queue lock
+#define LOG_ASYNC_QUEUE_RESERVE 4096
+
+#ifndef va_copy
+#define va_copy(dst, src) ((dst) = (src))
+#endif
+
 LogFilterData logFilterData[LOG_FILTER_COUNT] =
 {
     { "transport_moves",     "LogFilter_TransportMoves",     true  },
@@ -60,9 +72,63 @@ enum LogType
 
 const int LogType_count = int(LogError) +1;
 
+class LogWriter : public ACE_Based::Runnable
+{
+    public:
+        explicit LogWriter(Log* log) : m_log(log), m_running(true) {}
+
+        void Stop() { m_running = false; }
+
+        void run()
+        {
+            while (m_running)
+            {
+                ACE_Based::Thread::Sleep(LOG_WRITER_SLEEP);
+                m_log->WriteQueuedRecords();
+            }
+
+            // output queued before stop
+            m_log->WriteQueuedRecords();
+        }
+
+    private:
+        Log* m_log;
+        volatile bool m_running;
+};
+
+static std::string formatLogText(char const* str, va_list ap)
+{
+    char buf[LOG_FORMAT_BUFFER_SIZE];
+
+    va_list ap2;
+    va_copy(ap2, ap);
+    int res = vsnprintf(buf, LOG_FORMAT_BUFFER_SIZE, str, ap2);
+    va_end(ap2);
+
+    if (res >= 0 && res < LOG_FORMAT_BUFFER_SIZE)
+        return std::string(buf, res);
+
+    // not all vsnprintf versions return required size, grow buffer until output fit in this case
+    size_t size = res >= 0 ? size_t(res) + 1 : LOG_FORMAT_BUFFER_SIZE * 2;
+    for(;;)
+    {
+        std::vector<char> bigBuf(size);
+
+        va_copy(ap2, ap);
+        res = vsnprintf(&bigBuf[0], size, str, ap2);
+        va_end(ap2);
+
+        if (res >= 0 && size_t(res) < size)
+            return std::string(&bigBuf[0], res);
+
+        size = res >= 0 ? size_t(res) + 1 : size * 2;
+    }
+}
+
 Log::Log() :
     raLogfile(NULL), logfile(NULL), gmLogfile(NULL), charLogfile(NULL),
-    dberLogfile(NULL), m_colored(false), m_includeTime(false), m_gmlog_per_account(false)
+    dberLogfile(NULL), worldLogfile(NULL), m_colored(false), m_includeTime(false), m_gmlog_per_account(false),
+    m_async(false), m_asyncQueueLimit(0), m_droppedRecords(0), m_reportedDropped(0), m_writer(NULL), m_writerThread(NULL)
 {
     Initialize();
 }
@@ -275,6 +341,12 @@ void Log::Initialize()
 
     // Char log settings
     m_charLog_Dump = sConfig.GetBoolDefault("CharLogDump", false);
+
+    // Async file output settings
+    m_asyncQueueLimit = sConfig.GetIntDefault("LogAsyncQueueLimit", 100000);
+    m_async = sConfig.GetBoolDefault("LogAsync", false);
+    if (m_async)
+        StartAsyncWriter();
 }
 
 FILE* Log::openLogFile(char const* configFileName,char const* configTimeStampFlag, char const* mode)
@@ -305,36 +377,182 @@ FILE* Log::openGmlogPerAccount(uint32 account)
     return fopen(namebuf, "a");
 }
 
+void Log::outFile(FILE* file, LogLevel level, bool timestamp, char const* prefix, char const* str, va_list ap, bool newline)
+{
+    if (!m_async)
+    {
+        if (timestamp)
+            outTimestamp(file);
+
+        if (prefix)
+            fprintf(file, "%s", prefix);
+
+        vfprintf(file, str, ap);
+
+        if (newline)
+        {
+            fprintf(file, "\n" );
+            fflush(file);
+        }
+        return;
+    }
+
+    std::string text = prefix ? prefix : "";
+    text += formatLogText(str, ap);
+    if (newline)
+        text += "\n";
+
+    QueueRecord(file, level, timestamp, text);
+}
+
+void Log::outFile(FILE* file, LogLevel level, bool timestamp, std::string const& text)
+{
+    if (!m_async)
+    {
+        if (timestamp)
+            outTimestamp(file);
+
+        fprintf(file, "%s", text.c_str());
+        fflush(file);
+        return;
+    }
+
+    std::string record = text;
+    QueueRecord(file, level, timestamp, record);
+}
+
+/// text content moved to queued record
+void Log::QueueRecord(FILE* file, LogLevel level, bool timestamp, std::string& text)
+{
+    // timestamp text formatted by writer
+    time_t recordTime = timestamp ? time(NULL) : 0;
+
+    ACE_Guard<ACE_Thread_Mutex> guard(m_queueLock);
+
+    // if writer not keep up then drop only output enabled by log level, errors and unconditional output always queued
+    if (m_asyncQueueLimit && level > LOG_LVL_MINIMAL && m_queue.size() >= m_asyncQueueLimit)
+    {
+        ++m_droppedRecords;
+        return;
+    }
+
+    // empty record and string swap not allocate while queue not grow over reserved capacity
+    m_queue.push_back(LogRecord());
+    LogRecord& record = m_queue.back();
+    record.file = file;
+    record.time = recordTime;
+    record.text.swap(text);
+}
+
+void Log::StartAsyncWriter()
+{
+    if (m_writerThread)
+        return;
+
+    // queue and writer buffer swapped, both keep capacity
+    m_queue.reserve(LOG_ASYNC_QUEUE_RESERVE);
+    m_writeBuffer.reserve(LOG_ASYNC_QUEUE_RESERVE);
+
+    m_writer = new LogWriter(this);                         // will deleted at m_writerThread delete
+    m_writerThread = new ACE_Based::Thread(m_writer);
+}
+
+void Log::StopAsyncWriter()
+{
+    if (!m_writerThread)
+        return;
+
+    m_async = false;
+    m_writer->Stop();
+    m_writerThread->wait();                                 // write all queued output
+    delete m_writerThread;                                  // this also deletes m_writer
+    m_writerThread = NULL;
+    m_writer = NULL;
+}
+
+void Log::WriteQueuedRecords()
+{
+    uint32 dropped;
+    {
+        ACE_Guard<ACE_Thread_Mutex> guard(m_queueLock);
+        m_writeBuffer.swap(m_queue);
+        dropped = m_droppedRecords;
+    }
+
+    if (m_writeBuffer.empty() && dropped == m_reportedDropped)
+        return;
+
+    time_t lastTime = 0;
+    char timeStr[32] = "";
+
+    for(LogRecords::const_iterator itr = m_writeBuffer.begin(); itr != m_writeBuffer.end(); ++itr)
+    {
+        if (itr->time)
+        {
+            // most records in batch share same second
+            if (itr->time != lastTime)
+            {
+                lastTime = itr->time;
+                tm aTm;
+                ACE_OS::localtime_r(&lastTime, &aTm);
+                snprintf(timeStr, 32, "%-4d-%02d-%02d %02d:%02d:%02d ", aTm.tm_year+1900, aTm.tm_mon+1, aTm.tm_mday, aTm.tm_hour, aTm.tm_min, aTm.tm_sec);
+            }
+
+            fputs(timeStr, itr->file);
+        }
+
+        fwrite(itr->text.c_str(), 1, itr->text.size(), itr->file);
+    }
+
+    // keep capacity for next swap
+    m_writeBuffer.clear();
+
+    if (dropped != m_reportedDropped)
+    {
+        if (logfile)
+            fprintf(logfile, "Log: %u records dropped at full log queue\n", dropped - m_reportedDropped);
+        m_reportedDropped = dropped;
+    }
+
+    FILE* files[] = { logfile, gmLogfile, charLogfile, dberLogfile, raLogfile, worldLogfile };
+    for(size_t i = 0; i < sizeof(files)/sizeof(files[0]); ++i)
+        if (files[i])
+            fflush(files[i]);
+}
+
 void Log::outTimestamp(FILE* file)
 {
     time_t t = time(NULL);
-    tm* aTm = localtime(&t);
+    tm aTm;
+    ACE_OS::localtime_r(&t, &aTm);
     //       YYYY   year
     //       MM     month (2 digits 01-12)
     //       DD     day (2 digits 01-31)
     //       HH     hour (2 digits 00-23)
     //       MM     minutes (2 digits 00-59)
     //       SS     seconds (2 digits 00-59)
-    fprintf(file,"%-4d-%02d-%02d %02d:%02d:%02d ",aTm->tm_year+1900,aTm->tm_mon+1,aTm->tm_mday,aTm->tm_hour,aTm->tm_min,aTm->tm_sec);
+    fprintf(file,"%-4d-%02d-%02d %02d:%02d:%02d ",aTm.tm_year+1900,aTm.tm_mon+1,aTm.tm_mday,aTm.tm_hour,aTm.tm_min,aTm.tm_sec);
 }
 
 void Log::outTime()
 {
     time_t t = time(NULL);
-    tm* aTm = localtime(&t);
+    tm aTm;
+    ACE_OS::localtime_r(&t, &aTm);
     //       YYYY   year
     //       MM     month (2 digits 01-12)
     //       DD     day (2 digits 01-31)
     //       HH     hour (2 digits 00-23)
     //       MM     minutes (2 digits 00-59)
     //       SS     seconds (2 digits 00-59)
-    printf("%02d:%02d:%02d ",aTm->tm_hour,aTm->tm_min,aTm->tm_sec);
+    printf("%02d:%02d:%02d ",aTm.tm_hour,aTm.tm_min,aTm.tm_sec);
 }
 
 std::string Log::GetTimestampStr()
 {
     time_t t = time(NULL);
-    tm* aTm = localtime(&t);
+    tm aTm;
+    ACE_OS::localtime_r(&t, &aTm);
     //       YYYY   year
     //       MM     month (2 digits 01-12)
     //       DD     day (2 digits 01-31)
@@ -342,7 +560,7 @@ std::string Log::GetTimestampStr()
     //       MM     minutes (2 digits 00-59)
     //       SS     seconds (2 digits 00-59)
     char buf[20];
-    snprintf(buf,20,"%04d-%02d-%02d_%02d-%02d-%02d",aTm->tm_year+1900,aTm->tm_mon+1,aTm->tm_mday,aTm->tm_hour,aTm->tm_min,aTm->tm_sec);
+    snprintf(buf,20,"%04d-%02d-%02d_%02d-%02d-%02d",aTm.tm_year+1900,aTm.tm_mon+1,aTm.tm_mday,aTm.tm_hour,aTm.tm_min,aTm.tm_sec);
     return std::string(buf);
 }
 
@@ -351,6 +569,8 @@ void Log::outTitle( const char * str)
     if (!str)
         return;
 
+    Guard guard(*this);
+
     if (m_colored)
         SetColor(true,WHITE);
 
@@ -362,26 +582,20 @@ void Log::outTitle( const char * str)
 
     printf("\n");
     if (logfile)
-    {
-        fprintf(logfile, "%s", str);
-        fprintf(logfile, "\n" );
-        fflush(logfile);
-    }
+        outFile(logfile, LOG_LVL_MINIMAL, false, std::string(str) + "\n");
 
     fflush(stdout);
 }
 
 void Log::outString()
 {
+    Guard guard(*this);
+
     if (m_includeTime)
         outTime();
     printf( "\n" );
     if (logfile)
-    {
-        outTimestamp(logfile);
-        fprintf(logfile, "\n" );
-        fflush(logfile);
-    }
+        outFile(logfile, LOG_LVL_MINIMAL, true, "\n");
 
     fflush(stdout);
 }
@@ -391,6 +605,8 @@ void Log::outString( const char * str, ... )
     if (!str)
         return;
 
+    Guard guard(*this);
+
     if (m_colored)
         SetColor(true,m_colors[LogNormal]);
 
@@ -410,14 +626,9 @@ void Log::outString( const char * str, ... )
 
     if (logfile)
     {
-        outTimestamp(logfile);
-
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
-        fprintf(logfile, "\n" );
+        outFile(logfile, LOG_LVL_MINIMAL, true, NULL, str, ap);
         va_end(ap);
-
-        fflush(logfile);
     }
 
     fflush(stdout);
@@ -428,6 +639,8 @@ void Log::outError( const char * err, ... )
     if (!err)
         return;
 
+    Guard guard(*this);
+
     if (m_colored)
         SetColor(false,m_colors[LogError]);
 
@@ -446,15 +659,9 @@ void Log::outError( const char * err, ... )
     fprintf( stderr, "\n" );
     if (logfile)
     {
-        outTimestamp(logfile);
-        fprintf(logfile, "ERROR:" );
-
         va_start(ap, err);
-        vfprintf(logfile, err, ap);
+        outFile(logfile, LOG_LVL_MINIMAL, true, "ERROR:", err, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n" );
-        fflush(logfile);
     }
 
     fflush(stderr);
@@ -465,6 +672,8 @@ void Log::outErrorDb( const char * err, ... )
     if (!err)
         return;
 
+    Guard guard(*this);
+
     if (m_colored)
         SetColor(false,m_colors[LogError]);
 
@@ -484,28 +693,16 @@ void Log::outErrorDb( const char * err, ... )
 
     if (logfile)
     {
-        outTimestamp(logfile);
-        fprintf(logfile, "ERROR:" );
-
         va_start(ap, err);
-        vfprintf(logfile, err, ap);
+        outFile(logfile, LOG_LVL_MINIMAL, true, "ERROR:", err, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n" );
-        fflush(logfile);
     }
 
     if (dberLogfile)
     {
-        outTimestamp(dberLogfile);
-
-        va_list ap;
         va_start(ap, err);
-        vfprintf(dberLogfile, err, ap);
+        outFile(dberLogfile, LOG_LVL_MINIMAL, true, NULL, err, ap);
         va_end(ap);
-
-        fprintf(dberLogfile, "\n" );
-        fflush(dberLogfile);
     }
 
     fflush(stderr);
@@ -516,6 +713,8 @@ void Log::outBasic( const char * str, ... )
     if (!str)
         return;
 
+    Guard guard(*this);
+
     if (m_logLevel >= LOG_LVL_BASIC)
     {
         if (m_colored)
@@ -538,12 +737,9 @@ void Log::outBasic( const char * str, ... )
     if (logfile && m_logFileLevel >= LOG_LVL_BASIC)
     {
         va_list ap;
-        outTimestamp(logfile);
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
-        fprintf(logfile, "\n" );
+        outFile(logfile, LOG_LVL_BASIC, true, NULL, str, ap);
         va_end(ap);
-        fflush(logfile);
     }
 
     fflush(stdout);
@@ -554,6 +750,8 @@ void Log::outDetail( const char * str, ... )
     if (!str)
         return;
 
+    Guard guard(*this);
+
     if (m_logLevel >= LOG_LVL_DETAIL)
     {
 
@@ -576,15 +774,10 @@ void Log::outDetail( const char * str, ... )
 
     if (logfile && m_logFileLevel >= LOG_LVL_DETAIL)
     {
-        outTimestamp(logfile);
-
         va_list ap;
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
+        outFile(logfile, LOG_LVL_DETAIL, true, NULL, str, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n" );
-        fflush(logfile);
     }
 
     fflush(stdout);
@@ -595,6 +788,8 @@ void Log::outDebugInLine( const char * str, ... )
     if (!str)
         return;
 
+    Guard guard(*this);
+
     if (m_logLevel >= LOG_LVL_DEBUG)
     {
         if (m_colored)
@@ -613,7 +808,7 @@ void Log::outDebugInLine( const char * str, ... )
     {
         va_list ap;
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
+        outFile(logfile, LOG_LVL_DEBUG, false, NULL, str, ap, false);
         va_end(ap);
     }
 }
@@ -623,6 +818,8 @@ void Log::outDebug( const char * str, ... )
     if (!str)
         return;
 
+    Guard guard(*this);
+
     if (m_logLevel >= LOG_LVL_DEBUG)
     {
         if (m_colored)
@@ -644,15 +841,10 @@ void Log::outDebug( const char * str, ... )
 
     if (logfile && m_logFileLevel >= LOG_LVL_DEBUG)
     {
-        outTimestamp(logfile);
-
         va_list ap;
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
+        outFile(logfile, LOG_LVL_DEBUG, true, NULL, str, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n" );
-        fflush(logfile);
     }
 
     fflush(stdout);
@@ -663,6 +855,8 @@ void Log::outCommand( uint32 account, const char * str, ... )
     if (!str)
         return;
 
+    Guard guard(*this);
+
     if (m_logLevel >= LOG_LVL_DETAIL)
     {
         if (m_colored)
@@ -685,12 +879,9 @@ void Log::outCommand( uint32 account, const char * str, ... )
     if (logfile && m_logFileLevel >= LOG_LVL_DETAIL)
     {
         va_list ap;
-        outTimestamp(logfile);
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
-        fprintf(logfile, "\n" );
+        outFile(logfile, LOG_LVL_DETAIL, true, NULL, str, ap);
         va_end(ap);
-        fflush(logfile);
     }
 
     if (m_gmlog_per_account)
@@ -709,12 +900,9 @@ void Log::outCommand( uint32 account, const char * str, ... )
     else if (gmLogfile)
     {
         va_list ap;
-        outTimestamp(gmLogfile);
         va_start(ap, str);
-        vfprintf(gmLogfile, str, ap);
-        fprintf(gmLogfile, "\n" );
+        outFile(gmLogfile, LOG_LVL_MINIMAL, true, NULL, str, ap);
         va_end(ap);
-        fflush(gmLogfile);
     }
 
     fflush(stdout);
@@ -726,15 +914,14 @@ void Log::outChar(const char * str, ... )
     if (!str)
         return;
 
+    Guard guard(*this);
+
     if (charLogfile)
     {
         va_list ap;
-        outTimestamp(charLogfile);
         va_start(ap, str);
-        vfprintf(charLogfile, str, ap);
-        fprintf(charLogfile, "\n" );
+        outFile(charLogfile, LOG_LVL_MINIMAL, true, NULL, str, ap);
         va_end(ap);
-        fflush(charLogfile);
     }
 }
 
@@ -743,31 +930,45 @@ void Log::outWorldPacketDump( uint32 socket, uint32 opcode, char const* opcodeNa
     if (!worldLogfile)
         return;
 
-    outTimestamp(worldLogfile);
-
-    fprintf(worldLogfile,"\n%s:\nSOCKET: %u\nLENGTH: " SIZEFMTD "\nOPCODE: %s (0x%.4X)\nDATA:\n",
+    char buf[256];
+    snprintf(buf, 256, "\n%s:\nSOCKET: %u\nLENGTH: " SIZEFMTD "\nOPCODE: %s (0x%.4X)\nDATA:\n",
         incoming ? "CLIENT" : "SERVER",
         socket, packet->size(), opcodeName, opcode);
 
+    std::string text = buf;
+    text.reserve(text.size() + packet->size() * 3 + packet->size() / 16 + 3);
+
+    static char const hexDigits[] = "0123456789ABCDEF";
+
     size_t p = 0;
     while (p < packet->size())
     {
         for (size_t j = 0; j < 16 && p < packet->size(); ++j)
-            fprintf(worldLogfile, "%.2X ", (*packet)[p++]);
+        {
+            uint8 byte = (*packet)[p++];
+            text += hexDigits[byte >> 4];
+            text += hexDigits[byte & 0x0F];
+            text += ' ';
+        }
 
-        fprintf(worldLogfile, "\n");
+        text += '\n';
     }
 
-    fprintf(worldLogfile, "\n\n");
-    fflush(worldLogfile);
+    text += "\n\n";
+
+    Guard guard(*this);
+    outFile(worldLogfile, LOG_LVL_MINIMAL, true, text);
 }
 
 void Log::outCharDump( const char * str, uint32 account_id, uint32 guid, const char * name )
 {
     if (charLogfile)
     {
-        fprintf(charLogfile, "== START DUMP == (account: %u guid: %u name: %s )\n%s\n== END DUMP ==\n",account_id,guid,name,str );
-        fflush(charLogfile);
+        std::ostringstream ss;
+        ss << "== START DUMP == (account: " << account_id << " guid: " << guid << " name: " << name << " )\n" << str << "\n== END DUMP ==\n";
+
+        Guard guard(*this);
+        outFile(charLogfile, LOG_LVL_MINIMAL, false, ss.str());
     }
 }
 
@@ -776,6 +977,8 @@ void Log::outMenu( const char * str, ... )
     if (!str)
         return;
 
+    Guard guard(*this);
+
     SetColor(true,m_colors[LogNormal]);
 
     if (m_includeTime)
@@ -791,14 +994,9 @@ void Log::outMenu( const char * str, ... )
 
     if (logfile)
     {
-        outTimestamp(logfile);
-
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
+        outFile(logfile, LOG_LVL_MINIMAL, true, NULL, str, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n" );
-        fflush(logfile);
     }
     fflush(stdout);
 }
@@ -808,15 +1006,14 @@ void Log::outRALog(    const char * str, ... )
     if (!str)
         return;
 
+    Guard guard(*this);
+
     if (raLogfile)
     {
         va_list ap;
-        outTimestamp(raLogfile);
         va_start(ap, str);
-        vfprintf(raLogfile, str, ap);
-        fprintf(raLogfile, "\n" );
+        outFile(raLogfile, LOG_LVL_MINIMAL, true, NULL, str, ap);
         va_end(ap);
-        fflush(raLogfile);
     }
 
     fflush(stdout);
@@ -22,8 +22,12 @@
 #include "Common.h"
 #include "Policies/Singleton.h"
 
+#include <stdarg.h>
+#include <vector>
+
 class Config;
 class ByteBuffer;
+class LogWriter;
 
 enum LogLevel
 {
@@ -84,13 +88,28 @@ enum Color
 
 const int Color_count = int(WHITE)+1;
 
+// file output prepared by logging thread and written by log writer thread
+struct LogRecord
+{
+    LogRecord() : file(NULL), time(0) {}
+
+    FILE* file;
+    time_t time;                                            // 0 for output without timestamp
+    std::string text;
+};
+
+typedef std::vector<LogRecord> LogRecords;
+
 class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, ACE_Thread_Mutex> >
 {
     friend class MaNGOS::OperatorNew<Log>;
+    friend class LogWriter;
     Log();
 
     ~Log()
     {
+        StopAsyncWriter();
+
         if( logfile != NULL )
             fclose(logfile);
         logfile = NULL;
@@ -160,9 +179,19 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, ACE_Th
 
         static void WaitBeforeContinueIfNeed();
     private:
+        // held for whole output of one log call, lines from different threads not mixed
+        typedef MaNGOS::ClassLevelLockable<Log, ACE_Thread_Mutex>::Lock Guard;
+
         FILE* openLogFile(char const* configFileName,char const* configTimeStampFlag, char const* mode);
         FILE* openGmlogPerAccount(uint32 account);
 
+        void outFile(FILE* file, LogLevel level, bool timestamp, char const* prefix, char const* str, va_list ap, bool newline = true);
+        void outFile(FILE* file, LogLevel level, bool timestamp, std::string const& text);
+        void QueueRecord(FILE* file, LogLevel level, bool timestamp, std::string& text);
+        void StartAsyncWriter();
+        void StopAsyncWriter();
+        void WriteQueuedRecords();                          // called from log writer thread
+
         FILE* raLogfile;
         FILE* logfile;
         FILE* gmLogfile;
@@ -188,6 +217,17 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, ACE_Th
         // gm log control
         bool m_gmlog_per_account;
         std::string m_gmlog_filename_format;
+
+        // async file output control
+        bool m_async;
+        uint32 m_asyncQueueLimit;                           // 0 - no limit
+        ACE_Thread_Mutex m_queueLock;
+        LogRecords m_queue;                                 // guarded by m_queueLock
+        uint32 m_droppedRecords;                            // guarded by m_queueLock
+        LogRecords m_writeBuffer;                           // writer thread only
+        uint32 m_reportedDropped;                           // writer thread only
+        LogWriter* m_writer;                                // owned by m_writerThread
+        ACE_Based::Thread* m_writerThread;
 };
 
 #define sLog MaNGOS::Singleton<Log>::Instance()
@@ -21,6 +21,7 @@
 #include "ProgressBar.h"
 
 char const* const barGoLink::empty = " ";
+bool barGoLink::m_showOutput = true;
 #ifdef _WIN32
 char const* const barGoLink::full  = "\x3D";
 #else
@@ -29,6 +30,9 @@ char const* const barGoLink::full  = "*";
 
 barGoLink::~barGoLink()
 {
+    if (!m_showOutput)
+        return;
+
     printf( "\n" );
     fflush(stdout);
 }
@@ -39,6 +43,10 @@ barGoLink::barGoLink( int row_count )
     rec_pos   = 0;
     indic_len = 50;
     num_rec   = row_count;
+
+    if (!m_showOutput)
+        return;
+
     #ifdef _WIN32
     printf( "\x3D" );
     #else
@@ -59,6 +67,7 @@ void barGoLink::step( void )
 
     if ( num_rec == 0 ) return;
     ++rec_no;
+    if (!m_showOutput) return;
     n = rec_no * indic_len / num_rec;
     if ( n != rec_pos )
     {
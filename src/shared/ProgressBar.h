@@ -30,10 +30,14 @@ class MANGOS_DLL_SPEC barGoLink
     int num_rec;
     int indic_len;
 
+    static bool m_showOutput;                               // not recommended change with existed active bar
+
     public:
 
         void step( void );
         barGoLink( int );
         ~barGoLink();
+
+        static void SetOutputState(bool on) { m_showOutput = on; }
 };
 #endif
@@ -98,6 +98,161 @@ float GetFloatValueFromArray(Tokens const& data, uint16 index)
     return result;
 }
 
+static char const compactArrayChars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static inline int CompactArrayCharValue(char c)
+{
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+static inline void AppendVarUInt(std::string& bytes, uint64 value)
+{
+    while (value >= 0x80)
+    {
+        bytes += char(uint8(value) | 0x80);
+        value >>= 7;
+    }
+    bytes += char(value);
+}
+
+std::string UInt32ArrayToString(uint32 const* values, uint32 count)
+{
+    // lowest varint bit: 0 - value follows, 1 - run of zero values follows
+    std::string bytes;
+    bytes.reserve(count * 2);
+    for (uint32 i = 0; i < count;)
+    {
+        if (values[i])
+        {
+            AppendVarUInt(bytes, uint64(values[i]) << 1);
+            ++i;
+            continue;
+        }
+
+        uint32 run = 0;
+        for (; i < count && !values[i]; ++i)
+            ++run;
+        AppendVarUInt(bytes, (uint64(run) << 1) | 1);
+    }
+
+    // base64 without padding, safe for use in SQL strings
+    std::string result;
+    result.reserve(1 + (bytes.size() * 4 + 2) / 3);
+    result += UINT32_ARRAY_COMPACT_MARKER;
+    for (size_t i = 0; i < bytes.size(); i += 3)
+    {
+        size_t left = bytes.size() - i;
+        uint32 chunk = uint32(uint8(bytes[i])) << 16;
+        if (left > 1)
+            chunk |= uint32(uint8(bytes[i + 1])) << 8;
+        if (left > 2)
+            chunk |= uint32(uint8(bytes[i + 2]));
+
+        result += compactArrayChars[(chunk >> 18) & 0x3F];
+        result += compactArrayChars[(chunk >> 12) & 0x3F];
+        if (left > 1)
+            result += compactArrayChars[(chunk >> 6) & 0x3F];
+        if (left > 2)
+            result += compactArrayChars[chunk & 0x3F];
+    }
+
+    return result;
+}
+
+static uint32 UInt32ArrayFromCompactString(char const* data, uint32* values, uint32 maxCount)
+{
+    uint64 count = 0;
+    uint64 varint = 0;
+    uint32 shift = 0;
+    uint32 bits = 0;
+    uint32 bitCount = 0;
+
+    for (char const* p = data; *p; ++p)
+    {
+        int charValue = CompactArrayCharValue(*p);
+        if (charValue < 0)
+            return 0;
+
+        bits = (bits << 6) | uint32(charValue);
+        bitCount += 6;
+        if (bitCount < 8)
+            continue;
+
+        bitCount -= 8;
+        uint8 byte = uint8(bits >> bitCount);
+        bits &= (1 << bitCount) - 1;
+
+        // 33 bits at most, 5 bytes
+        if (shift > 28)
+            return 0;
+
+        varint |= uint64(byte & 0x7F) << shift;
+        if (byte & 0x80)
+        {
+            shift += 7;
+            continue;
+        }
+
+        if (varint & 1)
+        {
+            uint64 run = varint >> 1;
+            for (uint64 i = count; i < count + run && i < maxCount; ++i)
+                values[i] = 0;
+            count += run;
+        }
+        else
+        {
+            if (count < maxCount)
+                values[count] = uint32(varint >> 1);
+            ++count;
+        }
+
+        varint = 0;
+        shift = 0;
+    }
+
+    // truncated varint or lost base64 char
+    if (shift || bitCount >= 6)
+        return 0;
+
+    return count < 0xFFFFFFFF ? uint32(count) : 0xFFFFFFFF;
+}
+
+uint32 UInt32ArrayFromString(char const* data, uint32* values, uint32 maxCount)
+{
+    if (!data)
+        return 0;
+
+    if (IsCompactUInt32ArrayString(data))
+        return UInt32ArrayFromCompactString(data + 1, values, maxCount);
+
+    // old form, same result as StrSplit(data, " ") and atol for each token but without temporary strings
+    uint32 count = 0;
+    for (char const* p = data; *p;)
+    {
+        if (*p == ' ')
+        {
+            ++p;
+            continue;
+        }
+
+        char* end;
+        uint32 value = uint32(strtoul(p, &end, 10));
+        if (count < maxCount)
+            values[count] = value;
+        ++count;
+
+        for (p = end; *p && *p != ' '; ++p) {}
+    }
+
+    return count;
+}
+
 void stripLineInvisibleChars(std::string &str)
 {
     static std::string invChars = " \t\7\n";
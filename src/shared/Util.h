@@ -30,6 +30,20 @@ Tokens StrSplit(const std::string &src, const std::string &sep);
 uint32 GetUInt32ValueFromArray(Tokens const& data, uint16 index);
 float GetFloatValueFromArray(Tokens const& data, uint16 index);
 
+// uint32 arrays (update fields) stored in DB text columns, written in compact form:
+// marker and base64 of varint stream where zero value runs stored as one varint
+#define UINT32_ARRAY_COMPACT_MARKER '#'
+
+std::string UInt32ArrayToString(uint32 const* values, uint32 count);
+// accept compact and old space separated decimal form, return amount of values in data
+// (only first maxCount stored, values can be NULL for maxCount 0) or 0 for broken data
+uint32 UInt32ArrayFromString(char const* data, uint32* values, uint32 maxCount);
+
+inline bool IsCompactUInt32ArrayString(char const* data)
+{
+    return data && data[0] == UINT32_ARRAY_COMPACT_MARKER;
+}
+
 void stripLineInvisibleChars(std::string &src);
 
 std::string secsToTimeString(time_t timeInSecs, bool shortText = false, bool hoursOnly = false);
@@ -20,6 +20,7 @@
 #include "ModelInstance.h"
 #include "VMapManager2.h"
 #include "VMapDefinitions.h"
+#include "WorldModel.h"
 
 #include <string>
 #include <sstream>
@@ -34,50 +35,56 @@ namespace VMAP
     class MapRayCallback
     {
         public:
-            MapRayCallback(ModelInstance *val): prims(val), hit(false) {}
+            MapRayCallback(ModelInstance * const *val): prims(val), hit(false) {}
             bool operator()(const G3D::Ray& ray, uint32 entry, float& distance, bool pStopAtFirstHit=true)
             {
-                bool result = prims[entry].intersectRay(ray, distance, pStopAtFirstHit);
+                if (!prims[entry])
+                    return false;
+                bool result = prims[entry]->intersectRay(ray, distance, pStopAtFirstHit);
                 if (result)
                     hit = true;
                 return result;
             }
             bool didHit(){ return hit; }
         protected:
-            ModelInstance *prims;
+            ModelInstance * const *prims;
             bool hit;
     };
 
     class AreaInfoCallback
     {
         public:
-            AreaInfoCallback(ModelInstance *val): prims(val) {}
+            AreaInfoCallback(ModelInstance * const *val): prims(val) {}
             void operator()(const Vector3& point, uint32 entry)
             {
+                if (!prims[entry])
+                    return;
 #ifdef VMAP_DEBUG
-                DEBUG_LOG("trying to intersect '%s'", prims[entry].name.c_str());
+                DEBUG_LOG("trying to intersect '%s'", prims[entry]->name.c_str());
 #endif
-                prims[entry].intersectPoint(point, aInfo);
+                prims[entry]->intersectPoint(point, aInfo);
             }
 
-            ModelInstance *prims;
+            ModelInstance * const *prims;
             AreaInfo aInfo;
     };
 
     class LocationInfoCallback
     {
         public:
-            LocationInfoCallback(ModelInstance *val, LocationInfo &info): prims(val), locInfo(info), result(false) {}
+            LocationInfoCallback(ModelInstance * const *val, LocationInfo &info): prims(val), locInfo(info), result(false) {}
             void operator()(const Vector3& point, uint32 entry)
             {
+                if (!prims[entry])
+                    return;
 #ifdef VMAP_DEBUG
-                DEBUG_LOG("trying to intersect '%s'", prims[entry].name.c_str());
+                DEBUG_LOG("trying to intersect '%s'", prims[entry]->name.c_str());
 #endif
-                if (prims[entry].GetLocationInfo(point, locInfo))
+                if (prims[entry]->GetLocationInfo(point, locInfo))
                     result = true;
             }
 
-            ModelInstance *prims;
+            ModelInstance * const *prims;
             LocationInfo &locInfo;
             bool result;
     };
@@ -95,10 +102,10 @@ namespace VMAP
         return tilefilename.str();
     }
 
-    bool StaticMapTree::getAreaInfo(Vector3 &pos, uint32 &flags, int32 &adtId, int32 &rootId, int32 &groupId) const
+    bool MapTreeSnapshot::getAreaInfo(Vector3 &pos, uint32 &flags, int32 &adtId, int32 &rootId, int32 &groupId) const
     {
         AreaInfoCallback intersectionCallBack(iTreeValues);
-        iTree.intersectPoint(pos, intersectionCallBack);
+        iTree->intersectPoint(pos, intersectionCallBack);
         if (intersectionCallBack.aInfo.result)
         {
             flags = intersectionCallBack.aInfo.flags;
@@ -111,15 +118,37 @@ namespace VMAP
         return false;
     }
 
-    bool StaticMapTree::GetLocationInfo(const Vector3 &pos, LocationInfo &info) const
+    bool MapTreeSnapshot::GetLocationInfo(const Vector3 &pos, LocationInfo &info) const
     {
         LocationInfoCallback intersectionCallBack(iTreeValues, info);
-        iTree.intersectPoint(pos, intersectionCallBack);
+        iTree->intersectPoint(pos, intersectionCallBack);
         return intersectionCallBack.result;
     }
 
+    //=========================================================
+
+    void MapTreeGarbage::clear()
+    {
+        for (std::vector<ModelInstance*>::iterator i = instances.begin(); i != instances.end(); ++i)
+            delete *i;
+        for (std::vector<WorldModel*>::iterator i = models.begin(); i != models.end(); ++i)
+            delete *i;
+        delete tree;
+        instances.clear();
+        models.clear();
+        tree = 0;
+    }
+
+    MapTreeSnapshot::~MapTreeSnapshot()
+    {
+        delete[] iTreeValues;
+        iGarbage.clear();
+    }
+
+    //=========================================================
+
     StaticMapTree::StaticMapTree(uint32 mapID, const std::string &basePath):
-        iMapID(mapID), iTreeValues(0), iBasePath(basePath)
+        iMapID(mapID), iTree(0), iTreeValues(0), iNTreeValues(0), iBasePath(basePath)
     {
         if (iBasePath.length() > 0 && (iBasePath[iBasePath.length()-1] != '/' || iBasePath[iBasePath.length()-1] != '\\'))
         {
@@ -131,7 +160,47 @@ namespace VMAP
     //! Make sure to call unloadMap() to unregister acquired model references before destroying
     StaticMapTree::~StaticMapTree()
     {
+        // tree is still set only if it was never published
+        delete iTree;
         delete[] iTreeValues;
+        iGarbage.clear();
+    }
+
+    //=========================================================
+
+    MapTreeSnapshot* StaticMapTree::CreateSnapshot(MapTreeGarbage &garbage)
+    {
+        garbage.instances.insert(garbage.instances.end(), iGarbage.instances.begin(), iGarbage.instances.end());
+        garbage.models.insert(garbage.models.end(), iGarbage.models.begin(), iGarbage.models.end());
+        if (iGarbage.tree)
+        {
+            ASSERT(!garbage.tree);
+            garbage.tree = iGarbage.tree;
+        }
+        iGarbage.instances.clear();
+        iGarbage.models.clear();
+        iGarbage.tree = 0;
+
+        if (!iTree)
+            return NULL;
+
+        MapTreeSnapshot *snapshot = new MapTreeSnapshot();
+        snapshot->iTree = iTree;
+        snapshot->iNTreeValues = iNTreeValues;
+        snapshot->iTreeValues = new ModelInstance*[iNTreeValues];
+        if (iNTreeValues)
+            memcpy(snapshot->iTreeValues, iTreeValues, iNTreeValues * sizeof(ModelInstance*));
+        return snapshot;
+    }
+
+    //=========================================================
+
+    void StaticMapTree::releaseTreeValue(uint32 index, VMapManager2 *vm)
+    {
+        vm->releaseModelInstance(iTreeValues[index]->name, iGarbage);
+        // older snapshots may still use the instance
+        iGarbage.instances.push_back(iTreeValues[index]);
+        iTreeValues[index] = 0;
     }
 
     //=========================================================
@@ -140,18 +209,18 @@ namespace VMAP
     Else, pMaxDist is not modified and returns false;
     */
 
-    bool StaticMapTree::getIntersectionTime(const G3D::Ray& pRay, float &pMaxDist, bool pStopAtFirstHit) const
+    bool MapTreeSnapshot::getIntersectionTime(const G3D::Ray& pRay, float &pMaxDist, bool pStopAtFirstHit) const
     {
         float distance = pMaxDist;
         MapRayCallback intersectionCallBack(iTreeValues);
-        iTree.intersectRay(pRay, intersectionCallBack, distance, pStopAtFirstHit);
+        iTree->intersectRay(pRay, intersectionCallBack, distance, pStopAtFirstHit);
         if (intersectionCallBack.didHit())
             pMaxDist = distance;
         return intersectionCallBack.didHit();
     }
     //=========================================================
 
-    bool StaticMapTree::isInLineOfSight(const Vector3& pos1, const Vector3& pos2) const
+    bool MapTreeSnapshot::isInLineOfSight(const Vector3& pos1, const Vector3& pos2) const
     {
         float maxDist = (pos2 - pos1).magnitude();
         // valid map coords should *never ever* produce float overflow, but this would produce NaNs too:
@@ -172,7 +241,7 @@ namespace VMAP
     Return the hit pos or the original dest pos
     */
 
-    bool StaticMapTree::getObjectHitPos(const Vector3& pPos1, const Vector3& pPos2, Vector3& pResultHitPos, float pModifyDist) const
+    bool MapTreeSnapshot::getObjectHitPos(const Vector3& pPos1, const Vector3& pPos2, Vector3& pResultHitPos, float pModifyDist) const
     {
         bool result=false;
         float maxDist = (pPos2 - pPos1).magnitude();
@@ -217,7 +286,7 @@ namespace VMAP
 
     //=========================================================
 
-    float StaticMapTree::getHeight(const Vector3& pPos, float maxSearchDist) const
+    float MapTreeSnapshot::getHeight(const Vector3& pPos, float maxSearchDist) const
     {
         float height = G3D::inf();
         Vector3 dir = Vector3(0,0,-1);
@@ -287,11 +356,16 @@ namespace VMAP
             iIsTiled = bool(tiled);
             // Nodes
             if (success && !readChunk(rf, chunk, "NODE", 4)) success = false;
-            if (success) success = iTree.readFromFile(rf);
             if (success)
             {
-                iNTreeValues = iTree.primCount();
-                iTreeValues = new ModelInstance[iNTreeValues];
+                iTree = new BIH();
+                success = iTree->readFromFile(rf);
+            }
+            if (success)
+            {
+                iNTreeValues = iTree->primCount();
+                iTreeValues = new ModelInstance*[iNTreeValues];
+                memset(iTreeValues, 0, iNTreeValues * sizeof(ModelInstance*));
             }
 
             if (success && !readChunk(rf, chunk, "GOBJ", 4)) success = false;
@@ -308,7 +382,7 @@ namespace VMAP
                 if (model)
                 {
                     // assume that global model always is the first and only tree value (could be improved...)
-                    iTreeValues[0] = ModelInstance(spawn, model);
+                    iTreeValues[0] = new ModelInstance(spawn, model);
                     iLoadedSpawns[0] = 1;
                 }
                 else
@@ -329,12 +403,22 @@ namespace VMAP
     {
         for (loadedSpawnMap::iterator i = iLoadedSpawns.begin(); i != iLoadedSpawns.end(); ++i)
         {
-            iTreeValues[i->first].setUnloaded();
-            for (uint32 refCount = 0; refCount < i->second; ++refCount)
-                vm->releaseModelInstance(iTreeValues[i->first].name);
+            for (uint32 refCount = 1; refCount < i->second; ++refCount)
+                vm->releaseModelInstance(iTreeValues[i->first]->name, iGarbage);
+            releaseTreeValue(i->first, vm);
         }
         iLoadedSpawns.clear();
         iLoadedTiles.clear();
+
+        // tree itself is freed with the last snapshot using it
+        if (iTree)
+        {
+            iGarbage.tree = iTree;
+            iTree = 0;
+        }
+        delete[] iTreeValues;
+        iTreeValues = 0;
+        iNTreeValues = 0;
     }
 
     //=========================================================
@@ -390,16 +474,16 @@ namespace VMAP
                             continue;
                         }
 #endif
-                        iTreeValues[referencedVal] = ModelInstance(spawn, model);
+                        iTreeValues[referencedVal] = new ModelInstance(spawn, model);
                         iLoadedSpawns[referencedVal] = 1;
                     }
                     else
                     {
                         ++iLoadedSpawns[referencedVal];
 #ifdef VMAP_DEBUG
-                        if (iTreeValues[referencedVal].ID != spawn.ID)
+                        if (iTreeValues[referencedVal]->ID != spawn.ID)
                             DEBUG_LOG("Error: trying to load wrong spawn in node!");
-                        else if (iTreeValues[referencedVal].name != spawn.name)
+                        else if (iTreeValues[referencedVal]->name != spawn.name)
                             DEBUG_LOG("Error: name mismatch on GUID=%u", spawn.ID);
 #endif
                     }
@@ -444,9 +528,6 @@ namespace VMAP
                     result = ModelSpawn::readFromFile(tf, spawn);
                     if (result)
                     {
-                        // release model instance
-                        vm->releaseModelInstance(spawn.name);
-
                         // update tree
                         uint32 referencedNode;
 
@@ -454,12 +535,16 @@ namespace VMAP
                         if (!iLoadedSpawns.count(referencedNode))
                         {
                             ERROR_LOG("Trying to unload non-referenced model '%s' (ID:%u)", spawn.name.c_str(), spawn.ID);
+                            vm->releaseModelInstance(spawn.name, iGarbage);
                         }
                         else if (--iLoadedSpawns[referencedNode] == 0)
                         {
-                            iTreeValues[referencedNode].setUnloaded();
+                            // release model instance with its last reference
+                            releaseTreeValue(referencedNode, vm);
                             iLoadedSpawns.erase(referencedNode);
                         }
+                        else
+                            vm->releaseModelInstance(spawn.name, iGarbage);
                     }
                 }
                 fclose(tf);
@@ -37,6 +37,48 @@ namespace VMAP
         float ground_Z;
     };
 
+    class WorldModel;
+
+    // objects dropped from a map tree, can be freed only when no reader can see them anymore
+    struct MapTreeGarbage
+    {
+        MapTreeGarbage(): tree(0) {}
+        void clear();                                       // frees all collected objects
+
+        std::vector<ModelInstance*> instances;
+        std::vector<WorldModel*> models;
+        BIH *tree;
+    };
+
+    /**
+    Read only view of a StaticMapTree used by collision queries.
+    Each tile load/unload publishes a new snapshot, old one is kept alive (with all objects it refers)
+    until the last query using it finished, so queries never wait for tile loading.
+    */
+    class MapTreeSnapshot
+    {
+        friend class StaticMapTree;
+        friend class VMapManager2;
+        private:
+            const BIH *iTree;
+            ModelInstance **iTreeValues;                    // own copy of tree entries, NULL if spawn not loaded
+            uint32 iNTreeValues;
+            mutable uint32 iReaders;                        // guarded by VMapManager2 snapshot lock
+            MapTreeGarbage iGarbage;                        // objects not reachable from newer snapshots
+
+            MapTreeSnapshot(): iTree(0), iTreeValues(0), iNTreeValues(0), iReaders(0) {}
+            ~MapTreeSnapshot();
+
+            bool getIntersectionTime(const G3D::Ray& pRay, float &pMaxDist, bool pStopAtFirstHit) const;
+        public:
+            bool isInLineOfSight(const G3D::Vector3& pos1, const G3D::Vector3& pos2) const;
+            bool getObjectHitPos(const G3D::Vector3& pos1, const G3D::Vector3& pos2, G3D::Vector3& pResultHitPos, float pModifyDist) const;
+            float getHeight(const G3D::Vector3& pPos, float maxSearchDist) const;
+            bool getAreaInfo(G3D::Vector3 &pos, uint32 &flags, int32 &adtId, int32 &rootId, int32 &groupId) const;
+            bool GetLocationInfo(const Vector3 &pos, LocationInfo &info) const;
+    };
+
+    // Loading side of map collision data, used only under VMapManager2 load lock
     class StaticMapTree
     {
         typedef UNORDERED_MAP<uint32, bool> loadedTileMap;
@@ -44,8 +86,8 @@ namespace VMAP
         private:
             uint32 iMapID;
             bool iIsTiled;
-            BIH iTree;
-            ModelInstance *iTreeValues; // the tree entries
+            BIH *iTree;
+            ModelInstance **iTreeValues; // the tree entries
             uint32 iNTreeValues;
 
             // Store all the map tile idents that are loaded for that map
@@ -55,10 +97,11 @@ namespace VMAP
             // stores <tree_index, reference_count> to invalidate tree values, unload map, and to be able to report errors
             loadedSpawnMap iLoadedSpawns;
             std::string iBasePath;
+            // objects removed since last CreateSnapshot() call
+            MapTreeGarbage iGarbage;
 
         private:
-            bool getIntersectionTime(const G3D::Ray& pRay, float &pMaxDist, bool pStopAtFirstHit) const;
-            //bool containsLoadedMapTile(unsigned int pTileIdent) const { return(iLoadedMapTiles.containsKey(pTileIdent)); }
+            void releaseTreeValue(uint32 index, VMapManager2 *vm);
         public:
             static std::string getTileFileName(uint32 mapID, uint32 tileX, uint32 tileY);
             static uint32 packTileID(uint32 tileX, uint32 tileY) { return tileX<<16 | tileY; }
@@ -68,18 +111,16 @@ namespace VMAP
             StaticMapTree(uint32 mapID, const std::string &basePath);
             ~StaticMapTree();
 
-            bool isInLineOfSight(const G3D::Vector3& pos1, const G3D::Vector3& pos2) const;
-            bool getObjectHitPos(const G3D::Vector3& pos1, const G3D::Vector3& pos2, G3D::Vector3& pResultHitPos, float pModifyDist) const;
-            float getHeight(const G3D::Vector3& pPos, float maxSearchDist) const;
-            bool getAreaInfo(G3D::Vector3 &pos, uint32 &flags, int32 &adtId, int32 &rootId, int32 &groupId) const;
-            bool GetLocationInfo(const Vector3 &pos, LocationInfo &info) const;
-
             bool InitMap(const std::string &fname, VMapManager2 *vm);
             void UnloadMap(VMapManager2 *vm);
             bool LoadMapTile(uint32 tileX, uint32 tileY, VMapManager2 *vm);
             void UnloadMapTile(uint32 tileX, uint32 tileY, VMapManager2 *vm);
             bool isTiled() const { return iIsTiled; }
             uint32 numLoadedTiles() const { return iLoadedTiles.size(); }
+
+            // copy current state for readers (NULL if nothing loaded), objects removed since
+            // previous call are moved to garbage that must stay alive as long as previous snapshot
+            MapTreeSnapshot* CreateSnapshot(MapTreeGarbage &garbage);
     };
 
     struct AreaInfo
@@ -31,6 +31,20 @@ using G3D::Vector3;
 namespace VMAP
 {
 
+    // keeps map tree snapshot alive while a query uses it
+    class SnapshotHolder
+    {
+        public:
+            SnapshotHolder(const VMapManager2 *vm, uint32 mapId): iVm(vm), iSnapshot(vm->acquireSnapshot(mapId)) {}
+            ~SnapshotHolder() { if (iSnapshot) iVm->releaseSnapshot(iSnapshot); }
+
+            const MapTreeSnapshot* operator->() const { return iSnapshot; }
+            bool isNull() const { return !iSnapshot; }
+        private:
+            const VMapManager2 *iVm;
+            const MapTreeSnapshot *iSnapshot;
+    };
+
     //=========================================================
 
     VMapManager2::VMapManager2()
@@ -41,8 +55,17 @@ namespace VMAP
 
     VMapManager2::~VMapManager2(void)
     {
+        // no queries can be running at this point
+        for (InstanceSnapshotMap::iterator i = iInstanceSnapshots.begin(); i != iInstanceSnapshots.end(); ++i)
+            delete i->second;
+        for (std::deque<MapTreeSnapshot*>::iterator i = iRetiredSnapshots.begin(); i != iRetiredSnapshots.end(); ++i)
+            delete *i;
         for (InstanceTreeMap::iterator i = iInstanceMapTrees.begin(); i != iInstanceMapTrees.end(); ++i)
         {
+            MapTreeGarbage garbage;
+            i->second->UnloadMap(this);
+            i->second->CreateSnapshot(garbage);
+            garbage.clear();
             delete i->second;
         }
         for (ModelFileMap::iterator i = iLoadedModelFiles.begin(); i != iLoadedModelFiles.end(); ++i)
@@ -138,31 +161,118 @@ namespace VMAP
 
     bool VMapManager2::_loadMap(unsigned int pMapId, const std::string &basePath, uint32 tileX, uint32 tileY)
     {
+        Guard guard(iLoadLock);
+
         InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(pMapId);
         if (instanceTree == iInstanceMapTrees.end())
         {
             std::string mapFileName = getMapFileName(pMapId);
             StaticMapTree *newTree = new StaticMapTree(pMapId, basePath);
             if (!newTree->InitMap(mapFileName, this))
+            {
+                delete newTree;
                 return false;
+            }
             instanceTree = iInstanceMapTrees.insert(InstanceTreeMap::value_type(pMapId, newTree)).first;
         }
-        return instanceTree->second->LoadMapTile(tileX, tileY, this);
+        bool result = instanceTree->second->LoadMapTile(tileX, tileY, this);
+        publishSnapshot(pMapId, instanceTree->second);
+        return result;
+    }
+
+    //=========================================================
+    // drop tree without loaded tiles (internal use only, load lock must be held)
+
+    void VMapManager2::_unloadMap(uint32 pMapId, StaticMapTree *tree)
+    {
+        if (tree->numLoadedTiles() == 0)
+        {
+            // release global model of not tiled maps too
+            tree->UnloadMap(this);
+            publishSnapshot(pMapId, tree);
+            delete tree;
+            iInstanceMapTrees.erase(pMapId);
+        }
+        else
+            publishSnapshot(pMapId, tree);
+    }
+
+    //=========================================================
+    // replace map snapshot seen by queries and free snapshots not used anymore (load lock must be held)
+
+    void VMapManager2::publishSnapshot(uint32 pMapId, StaticMapTree *tree)
+    {
+        MapTreeGarbage garbage;
+        MapTreeSnapshot *snapshot = tree->CreateSnapshot(garbage);
+        std::vector<MapTreeSnapshot*> unused;
+        {
+            Guard guard(iSnapshotLock);
+
+            MapTreeSnapshot *old = NULL;
+            InstanceSnapshotMap::iterator itr = iInstanceSnapshots.find(pMapId);
+            if (itr != iInstanceSnapshots.end())
+            {
+                old = itr->second;
+                if (snapshot)
+                    itr->second = snapshot;
+                else
+                    iInstanceSnapshots.erase(itr);
+            }
+            else if (snapshot)
+                iInstanceSnapshots[pMapId] = snapshot;
+
+            if (old)
+            {
+                // removed objects could be used by old snapshot and all snapshots replaced before it
+                old->iGarbage = garbage;
+                garbage = MapTreeGarbage();
+                iRetiredSnapshots.push_back(old);
+            }
+
+            while (!iRetiredSnapshots.empty() && iRetiredSnapshots.front()->iReaders == 0)
+            {
+                unused.push_back(iRetiredSnapshots.front());
+                iRetiredSnapshots.pop_front();
+            }
+        }
+
+        // nothing can refer these objects, not published anywhere
+        garbage.clear();
+        for (std::vector<MapTreeSnapshot*>::iterator i = unused.begin(); i != unused.end(); ++i)
+            delete *i;
+    }
+
+    //=========================================================
+
+    const MapTreeSnapshot* VMapManager2::acquireSnapshot(uint32 pMapId) const
+    {
+        Guard guard(iSnapshotLock);
+
+        InstanceSnapshotMap::const_iterator itr = iInstanceSnapshots.find(pMapId);
+        if (itr == iInstanceSnapshots.end())
+            return NULL;
+
+        ++itr->second->iReaders;
+        return itr->second;
+    }
+
+    void VMapManager2::releaseSnapshot(const MapTreeSnapshot *snapshot) const
+    {
+        Guard guard(iSnapshotLock);
+        --snapshot->iReaders;
     }
 
     //=========================================================
 
     void VMapManager2::unloadMap(unsigned int pMapId)
     {
+        Guard guard(iLoadLock);
+
         InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(pMapId);
         if (instanceTree != iInstanceMapTrees.end())
         {
             instanceTree->second->UnloadMap(this);
-            if (instanceTree->second->numLoadedTiles() == 0)
-            {
-                delete instanceTree->second;
-                iInstanceMapTrees.erase(pMapId);
-            }
+            _unloadMap(pMapId, instanceTree->second);
         }
     }
 
@@ -170,15 +280,13 @@ namespace VMAP
 
     void VMapManager2::unloadMap(unsigned int  pMapId, int x, int y)
     {
+        Guard guard(iLoadLock);
+
         InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(pMapId);
         if (instanceTree != iInstanceMapTrees.end())
         {
             instanceTree->second->UnloadMapTile(x, y, this);
-            if (instanceTree->second->numLoadedTiles() == 0)
-            {
-                delete instanceTree->second;
-                iInstanceMapTrees.erase(pMapId);
-            }
+            _unloadMap(pMapId, instanceTree->second);
         }
     }
 
@@ -188,14 +296,14 @@ namespace VMAP
     {
         if (!isLineOfSightCalcEnabled()) return true;
         bool result = true;
-        InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(pMapId);
-        if (instanceTree != iInstanceMapTrees.end())
+        SnapshotHolder instanceTree(this, pMapId);
+        if (!instanceTree.isNull())
         {
             Vector3 pos1 = convertPositionToInternalRep(x1,y1,z1);
             Vector3 pos2 = convertPositionToInternalRep(x2,y2,z2);
             if (pos1 != pos2)
             {
-                result = instanceTree->second->isInLineOfSight(pos1, pos2);
+                result = instanceTree->isInLineOfSight(pos1, pos2);
             }
         }
         return result;
@@ -213,13 +321,13 @@ namespace VMAP
         rz=z2;
         if (isLineOfSightCalcEnabled())
         {
-            InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(pMapId);
-            if (instanceTree != iInstanceMapTrees.end())
+            SnapshotHolder instanceTree(this, pMapId);
+            if (!instanceTree.isNull())
             {
                 Vector3 pos1 = convertPositionToInternalRep(x1,y1,z1);
                 Vector3 pos2 = convertPositionToInternalRep(x2,y2,z2);
                 Vector3 resultPos;
-                result = instanceTree->second->getObjectHitPos(pos1, pos2, resultPos, pModifyDist);
+                result = instanceTree->getObjectHitPos(pos1, pos2, resultPos, pModifyDist);
                 resultPos = convertPositionToMangosRep(resultPos.x,resultPos.y,resultPos.z);
                 rx = resultPos.x;
                 ry = resultPos.y;
@@ -239,11 +347,11 @@ namespace VMAP
         float height = VMAP_INVALID_HEIGHT_VALUE;           //no height
         if (isHeightCalcEnabled())
         {
-            InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(pMapId);
-            if (instanceTree != iInstanceMapTrees.end())
+            SnapshotHolder instanceTree(this, pMapId);
+            if (!instanceTree.isNull())
             {
                 Vector3 pos = convertPositionToInternalRep(x,y,z);
-                height = instanceTree->second->getHeight(pos, maxSearchDist);
+                height = instanceTree->getHeight(pos, maxSearchDist);
                 if (!(height < G3D::inf()))
                 {
                     height = VMAP_INVALID_HEIGHT_VALUE;         //no height
@@ -258,11 +366,11 @@ namespace VMAP
     bool VMapManager2::getAreaInfo(unsigned int pMapId, float x, float y, float &z, uint32 &flags, int32 &adtId, int32 &rootId, int32 &groupId) const
     {
         bool result=false;
-        InstanceTreeMap::const_iterator instanceTree = iInstanceMapTrees.find(pMapId);
-        if (instanceTree != iInstanceMapTrees.end())
+        SnapshotHolder instanceTree(this, pMapId);
+        if (!instanceTree.isNull())
         {
             Vector3 pos = convertPositionToInternalRep(x, y, z);
-            result = instanceTree->second->getAreaInfo(pos, flags, adtId, rootId, groupId);
+            result = instanceTree->getAreaInfo(pos, flags, adtId, rootId, groupId);
             // z is not touched by convertPositionToMangosRep(), so just copy
             z = pos.z;
         }
@@ -271,12 +379,12 @@ namespace VMAP
 
     bool VMapManager2::GetLiquidLevel(uint32 pMapId, float x, float y, float z, uint8 ReqLiquidType, float &level, float &floor, uint32 &type) const
     {
-        InstanceTreeMap::const_iterator instanceTree = iInstanceMapTrees.find(pMapId);
-        if (instanceTree != iInstanceMapTrees.end())
+        SnapshotHolder instanceTree(this, pMapId);
+        if (!instanceTree.isNull())
         {
             LocationInfo info;
             Vector3 pos = convertPositionToInternalRep(x, y, z);
-            if (instanceTree->second->GetLocationInfo(pos, info))
+            if (instanceTree->GetLocationInfo(pos, info))
             {
                 floor = info.ground_Z;
                 type = info.hitModel->GetLiquidType();
@@ -311,7 +419,7 @@ namespace VMAP
         return model->second.getModel();
     }
 
-    void VMapManager2::releaseModelInstance(const std::string &filename)
+    void VMapManager2::releaseModelInstance(const std::string &filename, MapTreeGarbage &garbage)
     {
         ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
         if (model == iLoadedModelFiles.end())
@@ -322,7 +430,7 @@ namespace VMAP
         if( model->second.decRefCount() == 0)
         {
             DEBUG_LOG("VMapManager2: unloading file '%s'", filename.c_str());
-            delete model->second.getModel();
+            garbage.models.push_back(model->second.getModel());
             iLoadedModelFiles.erase(model);
         }
     }
@@ -24,6 +24,14 @@
 #include "Platform/Define.h"
 #include <G3D/Vector3.h>
 
+#ifndef NO_CORE_FUNCS
+    #include <ace/Thread_Mutex.h>
+#else
+    #include <ace/Null_Mutex.h>                             // extraction tools are single threaded and not linked with ACE
+#endif
+#include <ace/Guard_T.h>
+#include <deque>
+
 //===========================================================
 
 #define MAP_FILENAME_EXTENSION2 ".vmtree"
@@ -36,6 +44,10 @@ For each map or map tile to load it reads a directory file that contains the Mod
 Each global map or instance has its own dynamic BSP-Tree.
 The loaded ModelContainers are included in one of these BSP-Trees.
 Additionally a table to match map ids and map names is used.
+
+Loading and unloading can be done from any thread, they are serialized by one load lock.
+Queries use a read only snapshot of the map tree (see MapTreeSnapshot) and never wait for file loading,
+the snapshot lock only protects the current snapshot pointer exchange and its reader counter.
 */
 
 //===========================================================
@@ -43,7 +55,9 @@ Additionally a table to match map ids and map names is used.
 namespace VMAP
 {
     class StaticMapTree;
+    class MapTreeSnapshot;
     class WorldModel;
+    struct MapTreeGarbage;
 
     class ManagedModel
     {
@@ -59,19 +73,40 @@ namespace VMAP
     };
 
     typedef UNORDERED_MAP<uint32 , StaticMapTree *> InstanceTreeMap;
+    typedef UNORDERED_MAP<uint32 , MapTreeSnapshot *> InstanceSnapshotMap;
     typedef UNORDERED_MAP<std::string, ManagedModel> ModelFileMap;
 
     class VMapManager2 : public IVMapManager
     {
         protected:
-            // Tree to check collision
+#ifndef NO_CORE_FUNCS
+            typedef ACE_Thread_Mutex LockType;
+#else
+            typedef ACE_Null_Mutex LockType;
+#endif
+            typedef ACE_Guard<LockType> Guard;
+
+            // Tree to check collision, next 2 guarded by iLoadLock
             ModelFileMap iLoadedModelFiles;
             InstanceTreeMap iInstanceMapTrees;
             // UNORDERED_MAP<unsigned int , bool> iMapsSplitIntoTiles;
             UNORDERED_MAP<unsigned int , bool> iIgnoreMapIds;
 
+            // current snapshot of each map tree and replaced snapshots in replace order, guarded by iSnapshotLock
+            InstanceSnapshotMap iInstanceSnapshots;
+            std::deque<MapTreeSnapshot*> iRetiredSnapshots;
+
+            LockType iLoadLock;
+            mutable LockType iSnapshotLock;
+
             bool _loadMap(uint32 pMapId, const std::string &basePath, uint32 tileX, uint32 tileY);
-            /* void _unloadMap(uint32 pMapId, uint32 x, uint32 y); */
+            void _unloadMap(uint32 pMapId, StaticMapTree *tree);
+            void publishSnapshot(uint32 pMapId, StaticMapTree *tree);
+
+            const MapTreeSnapshot* acquireSnapshot(uint32 pMapId) const;
+            void releaseSnapshot(const MapTreeSnapshot *snapshot) const;
+
+            friend class SnapshotHolder;
 
         public:
             // public for debug
@@ -100,8 +135,9 @@ namespace VMAP
             bool getAreaInfo(unsigned int pMapId, float x, float y, float &z, uint32 &flags, int32 &adtId, int32 &rootId, int32 &groupId) const;
             bool GetLiquidLevel(uint32 pMapId, float x, float y, float z, uint8 ReqLiquidType, float &level, float &floor, uint32 &type) const;
 
+            // used by StaticMapTree under load lock, unused model is moved to garbage
             WorldModel* acquireModelInstance(const std::string &basepath, const std::string &filename);
-            void releaseModelInstance(const std::string &filename);
+            void releaseModelInstance(const std::string &filename, MapTreeGarbage &garbage);
 
             // what's the use of this? o.O
             virtual std::string getDirFileName(unsigned int pMapId, int x, int y) const